@@ -0,0 +1,464 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// Benchmark for the different communication formats
+// Measures the latency (ping-pong) and the bandwidth (streaming) of
+// exporting / importing data, meshes and Info over a range of message sizes.
+//
+// Usage:
+//   co_sim_io_benchmark [--formats file,pipe,...] [--kinds data,mesh,info]
+//                       [--min_size 8] [--max_size 1073741824] [--time 1.0]
+//                       [--output results.csv|results.json]
+//
+// By default the partner process is started automatically (not supported in Windows).
+// Alternatively both partners can be started manually by passing "--role primary" and
+// "--role secondary" (with otherwise identical arguments), which is also required for MPI.
+
+// System includes
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <memory>
+
+// Project includes
+#ifdef CO_SIM_IO_BENCHMARK_MPI
+#include "co_sim_io_mpi.hpp"
+#else
+#include "co_sim_io.hpp"
+#endif
+
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct BenchmarkSettings
+{
+    std::vector<std::string> Formats;
+    std::vector<std::string> Kinds {"data", "mesh", "info"};
+    std::size_t MinSize = 8;
+    std::size_t MaxSize = 1073741824; // 1 GB
+    double TimePerMeasurement = 1.0; // [s], approximately
+    std::string Output;
+    std::string Role;
+};
+
+struct BenchmarkResult
+{
+    std::string Format;
+    std::string Kind;
+    std::string Pattern;
+    std::size_t RequestedSize;
+    std::size_t MessageSize;
+    std::size_t Iterations;
+    double TotalTime;
+    double Latency;
+    double Bandwidth;
+};
+
+std::vector<std::string> SplitString(const std::string& rString)
+{
+    std::vector<std::string> tokens;
+    std::stringstream stream(rString);
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        if (!token.empty()) {tokens.push_back(token);}
+    }
+    return tokens;
+}
+
+std::vector<std::string> GetDefaultFormats()
+{
+    std::vector<std::string> formats {"file", "pipe", "shared_memory", "local_socket", "socket"};
+#if defined(CO_SIM_IO_BENCHMARK_MPI) && defined(CO_SIM_IO_BUILD_MPI_COMMUNICATION)
+    // the MPI formats can only be used with ConnectMPI
+    formats.push_back("mpi_inter");
+    formats.push_back("mpi_rma");
+#endif
+    return formats;
+}
+
+BenchmarkSettings ParseArguments(int argc, char** argv)
+{
+    BenchmarkSettings settings;
+    settings.Formats = GetDefaultFormats();
+
+    for (int i=1; i<argc; ++i) {
+        const std::string arg(argv[i]);
+        if (i+1 >= argc) {throw std::runtime_error("Missing value for argument " + arg);}
+        const std::string value(argv[++i]);
+
+        if      (arg == "--formats")  {settings.Formats = SplitString(value);}
+        else if (arg == "--kinds")    {settings.Kinds = SplitString(value);}
+        else if (arg == "--min_size") {settings.MinSize = std::stoull(value);}
+        else if (arg == "--max_size") {settings.MaxSize = std::stoull(value);}
+        else if (arg == "--time")     {settings.TimePerMeasurement = std::stod(value);}
+        else if (arg == "--output")   {settings.Output = value;}
+        else if (arg == "--role")     {settings.Role = value;}
+        else {throw std::runtime_error("Unknown argument " + arg);}
+    }
+
+    if (settings.MinSize == 0 || settings.MinSize > settings.MaxSize) {
+        throw std::runtime_error("Invalid range of message sizes!");
+    }
+
+    return settings;
+}
+
+// message sizes from MinSize to MaxSize, growing by a factor of 8
+std::vector<std::size_t> GetMessageSizes(const BenchmarkSettings& rSettings)
+{
+    std::vector<std::size_t> sizes;
+    for (std::size_t size=rSettings.MinSize; size<=rSettings.MaxSize; size*=8) {
+        sizes.push_back(size);
+        if (size > rSettings.MaxSize/8) {break;}
+    }
+    return sizes;
+}
+
+// the number of repetitions is estimated from the duration of one round trip
+// such that one measurement takes approximately the specified time
+std::size_t GetNumberOfIterations(const double TimePerMeasurement, const double RoundTripTime)
+{
+    const double num_iterations = TimePerMeasurement / std::max(RoundTripTime, 1e-9);
+    return static_cast<std::size_t>(std::max(3.0, std::min(1000.0, num_iterations)));
+}
+
+double ElapsedSeconds(const std::chrono::steady_clock::time_point& rStartTime)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - rStartTime).count();
+}
+
+// one kind of payload that is exchanged, e.g. data or a mesh
+class Payload
+{
+public:
+    virtual ~Payload() = default;
+    // returns the size of the message in bytes
+    virtual std::size_t Export(const CoSimIO::Info& I_Info) = 0;
+    virtual void Import(const CoSimIO::Info& I_Info) = 0;
+};
+
+class DataPayload : public Payload
+{
+public:
+    explicit DataPayload(const std::size_t Size)
+        : mExportData(std::max<std::size_t>(1, Size/sizeof(double)), 1.5) {}
+
+    std::size_t Export(const CoSimIO::Info& I_Info) override
+    {
+        return CoSimIO::ExportData(I_Info, mExportData).Get<std::size_t>("memory_usage_ipc");
+    }
+
+    void Import(const CoSimIO::Info& I_Info) override
+    {
+        CoSimIO::ImportData(I_Info, mImportData);
+    }
+
+private:
+    std::vector<double> mExportData;
+    std::vector<double> mImportData;
+};
+
+class MeshPayload : public Payload
+{
+public:
+    explicit MeshPayload(const std::size_t Size)
+        : mExportModelPart("benchmark_export"), mImportModelPart("benchmark_import")
+    {
+        // roughly 64 bytes per node including its line element
+        const CoSimIO::IdType num_nodes = std::max<CoSimIO::IdType>(2, static_cast<CoSimIO::IdType>(Size/64));
+        for (CoSimIO::IdType i=1; i<=num_nodes; ++i) {
+            mExportModelPart.CreateNewNode(i, 0.1*i, 0.2*i, 0.3*i);
+        }
+        for (CoSimIO::IdType i=1; i<num_nodes; ++i) {
+            mExportModelPart.CreateNewElement(i, CoSimIO::ElementType::Line2D2, {i, i+1});
+        }
+    }
+
+    std::size_t Export(const CoSimIO::Info& I_Info) override
+    {
+        return CoSimIO::ExportMesh(I_Info, mExportModelPart).Get<std::size_t>("memory_usage_ipc");
+    }
+
+    void Import(const CoSimIO::Info& I_Info) override
+    {
+        CoSimIO::ImportMesh(I_Info, mImportModelPart);
+    }
+
+private:
+    CoSimIO::ModelPart mExportModelPart;
+    CoSimIO::ModelPart mImportModelPart;
+};
+
+class InfoPayload : public Payload
+{
+public:
+    explicit InfoPayload(const std::size_t Size)
+        : mValue(Size, 'a') {}
+
+    std::size_t Export(const CoSimIO::Info& I_Info) override
+    {
+        CoSimIO::Info info(I_Info);
+        info.Set<std::string>("value", mValue);
+        return CoSimIO::ExportInfo(info).Get<std::size_t>("memory_usage_ipc");
+    }
+
+    void Import(const CoSimIO::Info& I_Info) override
+    {
+        CoSimIO::ImportInfo(I_Info);
+    }
+
+private:
+    std::string mValue;
+};
+
+std::unique_ptr<Payload> CreatePayload(const std::string& rKind, const std::size_t Size)
+{
+    if (rKind == "data") {return std::unique_ptr<Payload>(new DataPayload(Size));}
+    if (rKind == "mesh") {return std::unique_ptr<Payload>(new MeshPayload(Size));}
+    if (rKind == "info") {return std::unique_ptr<Payload>(new InfoPayload(Size));}
+    throw std::runtime_error("Unknown kind " + rKind + "! Available are: data, mesh, info");
+}
+
+CoSimIO::Info CreateInfo(const std::string& rConnectionName, const std::string& rIdentifier)
+{
+    CoSimIO::Info info;
+    info.Set<std::string>("identifier", rIdentifier);
+    info.Set<std::string>("connection_name", rConnectionName);
+    return info;
+}
+
+void BenchmarkFormat(
+    const BenchmarkSettings& rSettings,
+    const std::string& rFormat,
+    const bool IsPrimary,
+    std::vector<BenchmarkResult>& rResults)
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("my_name",    IsPrimary ? "benchmark_primary" : "benchmark_secondary");
+    settings.Set<std::string>("connect_to", IsPrimary ? "benchmark_secondary" : "benchmark_primary");
+    settings.Set<bool>("is_primary_connection", IsPrimary);
+    settings.Set<std::string>("communication_format", rFormat);
+    settings.Set<int>("echo_level", 0);
+
+#ifdef CO_SIM_IO_BENCHMARK_MPI
+    const std::string connection_name = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD).Get<std::string>("connection_name");
+#else
+    const std::string connection_name = CoSimIO::Connect(settings).Get<std::string>("connection_name");
+#endif
+
+    const CoSimIO::Info info_ping = CreateInfo(connection_name, "ping");
+    const CoSimIO::Info info_pong = CreateInfo(connection_name, "pong");
+    DataPayload ack(1);
+
+    for (const auto& r_kind : rSettings.Kinds) {
+        for (const std::size_t size : GetMessageSizes(rSettings)) {
+            const auto p_payload = CreatePayload(r_kind, size);
+            // warm up, this also establishes lazily created resources
+            // afterwards the primary decides on the number of iterations
+            std::size_t message_size = 0;
+            std::size_t num_iterations = 0;
+            CoSimIO::Info info_iterations = CreateInfo(connection_name, "iterations");
+            if (IsPrimary) {
+                const auto start_time_warm_up = std::chrono::steady_clock::now();
+                message_size = p_payload->Export(info_ping);
+                p_payload->Import(info_pong);
+                num_iterations = GetNumberOfIterations(rSettings.TimePerMeasurement, ElapsedSeconds(start_time_warm_up));
+                info_iterations.Set<std::size_t>("num_iterations", num_iterations);
+                CoSimIO::ExportInfo(info_iterations);
+            } else {
+                p_payload->Import(info_ping);
+                p_payload->Export(info_pong);
+                num_iterations = CoSimIO::ImportInfo(info_iterations).Get<std::size_t>("num_iterations");
+            }
+
+            // ping-pong: the message is sent back and forth, half of the round trip is the latency
+            auto start_time = std::chrono::steady_clock::now();
+            for (std::size_t i=0; i<num_iterations; ++i) {
+                if (IsPrimary) {
+                    p_payload->Export(info_ping);
+                    p_payload->Import(info_pong);
+                } else {
+                    p_payload->Import(info_ping);
+                    p_payload->Export(info_pong);
+                }
+            }
+            const double time_ping_pong = ElapsedSeconds(start_time);
+
+            // streaming: the messages are sent in one direction, the partner confirms the reception of the last one
+            start_time = std::chrono::steady_clock::now();
+            if (IsPrimary) {
+                for (std::size_t i=0; i<num_iterations; ++i) {
+                    p_payload->Export(info_ping);
+                }
+                ack.Import(info_pong);
+            } else {
+                for (std::size_t i=0; i<num_iterations; ++i) {
+                    p_payload->Import(info_ping);
+                }
+                ack.Export(info_pong);
+            }
+            const double time_streaming = ElapsedSeconds(start_time);
+
+            if (IsPrimary) {
+                const double latency = time_ping_pong / (2.0*num_iterations);
+                rResults.push_back({rFormat, r_kind, "ping_pong", size, message_size, num_iterations, time_ping_pong, latency, message_size/latency});
+                rResults.push_back({rFormat, r_kind, "streaming", size, message_size, num_iterations, time_streaming, time_streaming/num_iterations, message_size*num_iterations/time_streaming});
+
+                std::cout << rFormat << " | " << r_kind << " | " << message_size << " bytes | latency: "
+                          << latency*1e6 << " us | bandwidth: " << rResults.back().Bandwidth/1e6 << " MB/s" << std::endl;
+            }
+        }
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set<std::string>("connection_name", connection_name);
+    CoSimIO::Disconnect(disconnect_settings);
+}
+
+void WriteResults(const std::vector<BenchmarkResult>& rResults, const std::string& rFileName)
+{
+    const bool use_json = rFileName.size() >= 5 && rFileName.substr(rFileName.size()-5) == ".json";
+
+    std::ofstream output_file;
+    std::ostream* p_stream = &std::cout;
+    if (!rFileName.empty()) {
+        output_file.open(rFileName);
+        if (!output_file.is_open()) {throw std::runtime_error("Output file " + rFileName + " could not be opened!");}
+        p_stream = &output_file;
+    }
+    std::ostream& r_stream = *p_stream;
+    r_stream.precision(10);
+
+    if (use_json) {
+        r_stream << "[\n";
+        for (std::size_t i=0; i<rResults.size(); ++i) {
+            const auto& r = rResults[i];
+            r_stream << "  {\"communication_format\": \"" << r.Format << "\", \"kind\": \"" << r.Kind
+                     << "\", \"pattern\": \"" << r.Pattern << "\", \"requested_size\": " << r.RequestedSize
+                     << ", \"message_size\": " << r.MessageSize << ", \"iterations\": " << r.Iterations
+                     << ", \"total_time\": " << r.TotalTime << ", \"latency\": " << r.Latency
+                     << ", \"bandwidth\": " << r.Bandwidth << "}" << (i+1<rResults.size() ? "," : "") << "\n";
+        }
+        r_stream << "]\n";
+    } else {
+        r_stream << "communication_format,kind,pattern,requested_size,message_size,iterations,total_time,latency,bandwidth\n";
+        for (const auto& r : rResults) {
+            r_stream << r.Format << "," << r.Kind << "," << r.Pattern << "," << r.RequestedSize << ","
+                     << r.MessageSize << "," << r.Iterations << "," << r.TotalTime << ","
+                     << r.Latency << "," << r.Bandwidth << "\n";
+        }
+    }
+}
+
+int RunBenchmark(const BenchmarkSettings& rSettings, const bool IsPrimary)
+{
+    std::vector<BenchmarkResult> results;
+    for (const auto& r_format : rSettings.Formats) {
+        BenchmarkFormat(rSettings, r_format, IsPrimary, results);
+
+        // the output file is rewritten after each format, such that the results are not lost if a later format fails
+        if (IsPrimary && !rSettings.Output.empty()) {
+            WriteResults(results, rSettings.Output);
+        }
+    }
+
+    if (IsPrimary && rSettings.Output.empty()) {
+        WriteResults(results, rSettings.Output);
+    }
+
+    return 0;
+}
+
+#ifndef CO_SIM_IO_BENCHMARK_MPI
+int StartPartnerAndRunBenchmark(int argc, char** argv, const BenchmarkSettings& rSettings)
+{
+#ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+    throw std::runtime_error("Starting the partner automatically is not supported in Windows, use \"--role\"!");
+#else
+    const pid_t pid = fork();
+    if (pid < 0) {throw std::runtime_error("Partner process could not be started!");}
+
+    if (pid == 0) {
+        std::vector<char*> partner_args(argv, argv+argc);
+        std::string role_arg("--role");
+        std::string role_value("secondary");
+        partner_args.push_back(&role_arg.front());
+        partner_args.push_back(&role_value.front());
+        partner_args.push_back(nullptr);
+        execv("/proc/self/exe", partner_args.data());
+        execvp(argv[0], partner_args.data()); // in case "/proc" is not available
+        std::cerr << "Partner process could not be started!" << std::endl;
+        _exit(1);
+    }
+
+    const int exit_code = RunBenchmark(rSettings, true);
+
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cerr << "Partner process failed!" << std::endl;
+        return 1;
+    }
+
+    return exit_code;
+#endif
+}
+#endif
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+#ifdef CO_SIM_IO_BENCHMARK_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    int exit_code = 0;
+
+    try {
+        const BenchmarkSettings settings = ParseArguments(argc, argv);
+
+        if (settings.Role == "primary") {
+            exit_code = RunBenchmark(settings, true);
+        } else if (settings.Role == "secondary") {
+            exit_code = RunBenchmark(settings, false);
+        } else if (settings.Role.empty()) {
+#ifdef CO_SIM_IO_BENCHMARK_MPI
+            throw std::runtime_error("The partners have to be started manually with MPI, use \"--role\"!");
+#else
+            exit_code = StartPartnerAndRunBenchmark(argc, argv, settings);
+#endif
+        } else {
+            throw std::runtime_error("Unknown role " + settings.Role + "! Available are: primary, secondary");
+        }
+    } catch (const std::exception& rException) {
+        std::cerr << rException.what() << std::endl;
+        exit_code = 1;
+    }
+
+#ifdef CO_SIM_IO_BENCHMARK_MPI
+    MPI_Finalize();
+#endif
+
+    return exit_code;
+}
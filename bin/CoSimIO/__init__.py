@@ -0,0 +1,2 @@
+from PyCoSimIO import *
+from PyCoSimIO import __version__
@@ -0,0 +1 @@
+from PyCoSimIOMPI import *
@@ -0,0 +1 @@
+raise Exception('The mpi4py interface was not compiled! (use "CO_SIM_IO_BUILD_PYTHON_MPI4PY_INTERFACE" to enable it)')
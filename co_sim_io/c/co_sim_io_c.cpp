@@ -109,6 +109,12 @@ CoSimIO_Info CoSimIO_ExportInfo(
     return ConvertInfo(CoSimIO::ExportInfo(ConvertInfo(I_Info)));
 }
 
+CoSimIO_Info CoSimIO_GetStatistics(
+    const CoSimIO_Info I_Info)
+{
+    return ConvertInfo(CoSimIO::GetStatistics(ConvertInfo(I_Info)));
+}
+
 CoSimIO_Info CoSimIO_Register(
     const CoSimIO_Info I_Info,
     CoSimIO_Info (*I_FunctionPointer)(const CoSimIO_Info I_Info))
@@ -378,6 +384,11 @@ double CoSimIO_Node_Coordinate(CoSimIO_Node I_Node, const int I_Index)
     return static_cast<CoSimIO::Node*>(I_Node.PtrCppNode)->Coordinates()[I_Index];
 }
 
+void CoSimIO_Node_SetCoordinates(CoSimIO_Node I_Node, const double I_X, const double I_Y, const double I_Z)
+{
+    static_cast<CoSimIO::Node*>(I_Node.PtrCppNode)->SetCoordinates(I_X, I_Y, I_Z);
+}
+
 
 CoSimIO_Node CoSimIO_ModelPart_GetNodeByIndex(CoSimIO_ModelPart I_ModelPart, const int I_Index)
 {
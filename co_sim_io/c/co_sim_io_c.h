@@ -72,6 +72,9 @@ CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ImportInfo(
 CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ExportInfo(
     const CoSimIO_Info I_Info);
 
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_GetStatistics(
+    const CoSimIO_Info I_Info);
+
 CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_Register(
     const CoSimIO_Info I_Info,
     CoSimIO_Info (*I_FunctionPointer)(const CoSimIO_Info I_Info));
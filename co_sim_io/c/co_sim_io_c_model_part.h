@@ -66,6 +66,7 @@ double CoSimIO_Node_X(CoSimIO_Node I_Node);
 double CoSimIO_Node_Y(CoSimIO_Node I_Node);
 double CoSimIO_Node_Z(CoSimIO_Node I_Node);
 double CoSimIO_Node_Coordinate(CoSimIO_Node I_Node, const int I_Index);
+void CoSimIO_Node_SetCoordinates(CoSimIO_Node I_Node, const double I_X, const double I_Y, const double I_Z);
 
 
 /* Element functions */
@@ -34,3 +34,9 @@ CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ConnectMPI(
 {
     return ConvertInfo(CoSimIO::ConnectMPI(ConvertInfo(I_Settings), ThisMPIComm));
 }
+
+MPI_Comm CoSimIO_GetMergedMPICommunicator(
+    const CoSimIO_Info I_Info)
+{
+    return CoSimIO::GetMergedMPICommunicator(ConvertInfo(I_Info));
+}
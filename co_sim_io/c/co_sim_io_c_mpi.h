@@ -28,6 +28,9 @@ CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ConnectMPI(
     const CoSimIO_Info I_Settings,
     MPI_Comm ThisMPIComm);
 
+MPI_Comm CoSimIO_GetMergedMPICommunicator(
+    const CoSimIO_Info I_Info);
+
 #ifdef __cplusplus
 }
 #endif
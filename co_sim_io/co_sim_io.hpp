@@ -18,6 +18,12 @@ This file defines the IO of Kratos-CoSimulation for the exchange of data with ex
 */
 
 // System includes
+#include <complex>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
 
 // Project includes
 #include "includes/define.hpp"
@@ -37,6 +43,8 @@ Info CO_SIM_IO_API Disconnect(
     const Info& I_Info);
 
 
+// besides double, the data can be of type float, std::int32_t, std::int64_t and std::complex<double>
+// the type must be the same on both sides
 template<class TContainerType>
 Info CO_SIM_IO_API ImportData(
     const Info& I_Info,
@@ -47,6 +55,30 @@ Info CO_SIM_IO_API ExportData(
     const Info& I_Info,
     const TContainerType& rData);
 
+// exchanging several containers at once, with only one message
+// the identifiers and the order of the containers must be the same on both sides
+template<class TContainerType>
+Info CO_SIM_IO_API ImportDataBatch(
+    const Info& I_Info,
+    const std::vector<std::pair<std::string, TContainerType*>>& rData);
+
+template<class TContainerType>
+Info CO_SIM_IO_API ExportDataBatch(
+    const Info& I_Info,
+    const std::vector<std::pair<std::string, const TContainerType*>>& rData);
+
+// non-blocking versions of Im-/ExportData
+// rData must not be accessed (import) or modified (export) until the returned future is ready
+template<class TContainerType>
+std::future<Info> CO_SIM_IO_API ImportDataAsync(
+    const Info& I_Info,
+    TContainerType& rData);
+
+template<class TContainerType>
+std::future<Info> CO_SIM_IO_API ExportDataAsync(
+    const Info& I_Info,
+    const TContainerType& rData);
+
 
 Info CO_SIM_IO_API ImportMesh(
     const Info& I_Info,
@@ -62,6 +94,10 @@ Info CO_SIM_IO_API ImportInfo(
 Info CO_SIM_IO_API ExportInfo(
     const Info& I_Info);
 
+// timings and transferred bytes of the operations of a connection, per operation and identifier
+Info CO_SIM_IO_API GetStatistics(
+    const Info& I_Info);
+
 
 Info CO_SIM_IO_API Run(const Info& I_Info);
 
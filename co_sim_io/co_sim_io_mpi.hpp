@@ -29,6 +29,10 @@ Info ConnectMPI(
     const Info& I_Settings,
     MPI_Comm ThisMPIComm);
 
+// intracommunicator that contains the ranks of both partners (first the ranks of the primary connection)
+// requires "merge_communicators" (or the "mpi_rma" communication format), it is freed in Disconnect
+MPI_Comm GetMergedMPICommunicator(const Info& I_Info);
+
 } // namespace CoSimIO
 
 #endif // CO_SIM_IO_MPI_INCLUDED
@@ -14,7 +14,13 @@
 #define CO_SIM_IO_BASE_SOCKET_COMMUNICATION_INCLUDED
 
 // System includes
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 // Project includes
 #include "communication.hpp"
@@ -47,6 +53,7 @@ public:
 
 protected:
     std::shared_ptr<TSocketType> mpAsioSocket;
+    std::vector<std::shared_ptr<TSocketType>> mpAsioStreamSockets; // additional sockets, large messages are striped across all sockets
     asio::io_context mAsioContext;
     std::thread mContextThread;
 
@@ -66,9 +73,56 @@ protected:
         const Info& I_Info,
         Internals::DataContainer<double>& rData) override;
 
+    double SendDataBuffers(
+        const Info& I_Info,
+        const std::string& rHeader,
+        const std::vector<ConstDataBufferType>& rBuffers) override;
+
+    double ReceiveDataBuffers(
+        const Info& I_Info,
+        const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived) override;
+
     void SendSize(const std::uint64_t Size);
 
     std::uint64_t ReceiveSize();
+
+    // called before every message is received, e.g. to set socket options that are reset by the OS
+    virtual void PrepareReceive() {}
+
+    // the first NumHeaderBuffers are always written to the main socket, the remaining ones might be striped
+    void WriteBuffers(
+        const std::vector<asio::const_buffer>& rBuffers,
+        const std::size_t NumHeaderBuffers=0);
+
+    void ReadBuffers(const std::vector<asio::mutable_buffer>& rBuffers);
+
+private:
+    // each additional stream has a worker thread that transfers its stripes, they live as long as the connection
+    struct StreamWorker
+    {
+        std::thread Thread;
+        std::mutex Mutex;
+        std::condition_variable TaskAvailable;
+        std::deque<std::function<void()>> Tasks;
+        bool Stop = false;
+    };
+    std::vector<std::unique_ptr<StreamWorker>> mStreamWorkers;
+
+    void StartStreamWorkers();
+
+    void StopStreamWorkers();
+
+    // executes the function for every stream, the first stream is executed by the calling thread
+    void ForEachStream(
+        const std::size_t NumStreams,
+        const std::function<void(const std::size_t)>& rFunction);
+
+    // makes the pending and future operations on all sockets fail, also the ones of the partner
+    void ShutdownSockets();
+
+    std::size_t GetNumStripes(const std::size_t PayloadSize) const;
+
+    TSocketType& GetStreamSocket(const std::size_t Index);
 };
 
 } // namespace Internals
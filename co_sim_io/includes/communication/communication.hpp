@@ -15,7 +15,15 @@
 
 // System includes
 #include <utility>
+#include <vector>
 #include <tuple>
+#include <deque>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <unordered_map>
 
 // Project includes
 #include "includes/info.hpp"
@@ -24,6 +32,9 @@
 #include "includes/data_communicator.hpp"
 #include "includes/filesystem_inc.hpp"
 #include "includes/utilities.hpp"
+#include "includes/compression.hpp"
+#include "includes/statistics.hpp"
+#include "includes/tracer.hpp"
 
 namespace CoSimIO {
 namespace Internals {
@@ -32,12 +43,20 @@ namespace Internals {
 class CO_SIM_IO_API Communication
 {
 public:
+    // pairs of identifier and data, exchanged together in one message
+    using DataBatchType = std::vector<std::pair<std::string, Internals::DataContainer<double>*>>;
+    using ConstDataBatchType = std::vector<std::pair<std::string, const Internals::DataContainer<double>*>>;
+
+    // memory of a data container (pointer and size in bytes), used for transferring data independent of its type
+    using DataBufferType = std::pair<char*, std::size_t>;
+    using ConstDataBufferType = std::pair<const char*, std::size_t>;
+
     Communication(
         const Info& I_Settings,
         std::shared_ptr<DataCommunicator> I_DataComm);
 
     // might throw when trying to remove files!
-    virtual ~Communication() noexcept(false) {}; // impl of disconnect has to be in derived class due to order of class destruction
+    virtual ~Communication() noexcept(false); // impl of disconnect has to be in derived class due to order of class destruction
 
     Info Connect(const Info& I_Info);
 
@@ -50,15 +69,17 @@ public:
 
         CheckConnection(i_info);
 
+        const Tracer::Scope trace_scope(mTracer, "export_info", "operation", i_info.Get<std::string>("identifier"));
+
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Info \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ExportInfoImpl(std::forward<Args>(args)...);
+        Info o_info = ExportInfoToPartnerRanks(std::forward<Args>(args)...);
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Info " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
-        PrintElapsedTime(i_info, o_info, "Export info");
+        RecordElapsedTime(i_info, o_info, "Export info");
 
         return o_info;
     }
@@ -70,15 +91,17 @@ public:
 
         CheckConnection(i_info);
 
+        const Tracer::Scope trace_scope(mTracer, "import_info", "operation", i_info.Get<std::string>("identifier"));
+
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Info \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ImportInfoImpl(std::forward<Args>(args)...);
+        Info o_info = ImportInfoFromPartnerRanks(std::forward<Args>(args)...);
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Info " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
-        PrintElapsedTime(i_info, o_info, "Import info");
+        RecordElapsedTime(i_info, o_info, "Import info");
 
         return o_info;
     }
@@ -90,15 +113,17 @@ public:
 
         CheckConnection(i_info);
 
+        const Tracer::Scope trace_scope(mTracer, "import_data", "operation", i_info.Get<std::string>("identifier"));
+
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Data \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ImportDataImpl(std::forward<Args>(args)...);
+        Info o_info = ImportDataFromPartnerRanks(std::forward<Args>(args)...);
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Data " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
-        PrintElapsedTime(i_info, o_info, "Import data");
+        RecordElapsedTime(i_info, o_info, "Import data");
 
         return o_info;
     }
@@ -110,19 +135,86 @@ public:
 
         CheckConnection(i_info);
 
+        const Tracer::Scope trace_scope(mTracer, "export_data", "operation", i_info.Get<std::string>("identifier"));
+
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Data \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ExportDataImpl(std::forward<Args>(args)...);
+        Info o_info = ExportDataToPartnerRanks(std::forward<Args>(args)...);
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Data " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
-        PrintElapsedTime(i_info, o_info, "Export data");
+        RecordElapsedTime(i_info, o_info, "Export data");
+
+        return o_info;
+    }
+
+    template<class... Args>
+    Info ImportDataBatch(Args&&... args)
+    {
+        const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+
+        CheckConnection(i_info);
+
+        const Tracer::Scope trace_scope(mTracer, "import_data_batch", "operation", i_info.Get<std::string>("identifier"));
+
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Data batch \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
+
+        Info o_info = ImportDataBatchFromPartnerRanks(std::forward<Args>(args)...);
+
+        PostChecks(o_info);
+
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Data batch " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
+
+        RecordElapsedTime(i_info, o_info, "Import data batch");
 
         return o_info;
     }
 
+    template<class... Args>
+    Info ExportDataBatch(Args&&... args)
+    {
+        const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+
+        CheckConnection(i_info);
+
+        const Tracer::Scope trace_scope(mTracer, "export_data_batch", "operation", i_info.Get<std::string>("identifier"));
+
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Data batch \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
+
+        Info o_info = ExportDataBatchToPartnerRanks(std::forward<Args>(args)...);
+
+        PostChecks(o_info);
+
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Data batch " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
+
+        RecordElapsedTime(i_info, o_info, "Export data batch");
+
+        return o_info;
+    }
+
+    // timings and transferred bytes of the operations since connecting, per operation and identifier
+    Info GetStatistics() const {return mStatistics.GetInfo();}
+
+    // used to record events outside of the communication, e.g. the run control signals
+    Tracer& GetTracer() {return mTracer;}
+
+    // data communicator that contains the ranks of both partners, only available if the communication supports it
+    virtual std::shared_ptr<DataCommunicator> GetMergedDataCommunicator() const;
+
+    // the data must not be accessed until the returned future is ready
+    // the asynchronous operations are executed in the order in which they were issued,
+    // all blocking operations wait until the pending asynchronous operations are completed
+    std::future<Info> ImportDataAsync(
+        const Info& I_Info,
+        std::shared_ptr<Internals::DataContainer<double>> pData);
+
+    // the data must not be modified until the returned future is ready
+    std::future<Info> ExportDataAsync(
+        const Info& I_Info,
+        std::shared_ptr<const Internals::DataContainer<double>> pData);
+
     template<class... Args>
     Info ImportMesh(Args&&... args)
     {
@@ -130,15 +222,17 @@ public:
 
         CheckConnection(i_info);
 
+        const Tracer::Scope trace_scope(mTracer, "import_mesh", "operation", i_info.Get<std::string>("identifier"));
+
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Mesh \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ImportMeshImpl(std::forward<Args>(args)...);
+        Info o_info = ImportMeshFromPartnerRanks(std::forward<Args>(args)...);
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Mesh " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
-        PrintElapsedTime(i_info, o_info, "Import mesh");
+        RecordElapsedTime(i_info, o_info, "Import mesh");
 
         return o_info;
     }
@@ -150,15 +244,17 @@ public:
 
         CheckConnection(i_info);
 
+        const Tracer::Scope trace_scope(mTracer, "export_mesh", "operation", i_info.Get<std::string>("identifier"));
+
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Mesh \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ExportMeshImpl(std::forward<Args>(args)...);
+        Info o_info = ExportMeshToPartnerRanks(std::forward<Args>(args)...);
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Mesh " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
-        PrintElapsedTime(i_info, o_info, "Export mesh");
+        RecordElapsedTime(i_info, o_info, "Export mesh");
 
         return o_info;
     }
@@ -174,10 +270,18 @@ protected:
     const DataCommunicator& GetDataCommunicator()  const {return *mpDataComm;}
     bool GetAlwaysUseSerializer() const        {return mAlwaysUseSerializer;}
     Serializer::TraceType GetSerializerTraceType() const {return mSerializerTraceType;}
+    Compression::CompressionType GetCompression() const {return mCompression;}
 
     Info GetMyInfo() const;
     Info GetPartnerInfo() const {return mPartnerInfo;};
 
+    // only available after the handshake
+    int GetPartnerSize() const {return mPartnerSize;}
+
+    // if the partner runs with fewer processes then not all of my ranks have a partner rank to communicate with
+    // only available after the handshake
+    bool HasPartnerRank() const {return GetDataCommunicator().Rank() < mPartnerSize;}
+
     fs::path GetTmpFileName(
         const fs::path& rPath,
         const bool UseAuxFileForFileAvailability=true) const;
@@ -215,6 +319,33 @@ protected:
         const Info& I_Info,
         const Internals::DataContainer<double>& rData);
 
+    virtual Info ImportDataBatchImpl(
+        const Info& I_Info,
+        const DataBatchType& rData);
+
+    virtual Info ExportDataBatchImpl(
+        const Info& I_Info,
+        const ConstDataBatchType& rData);
+
+    // by default the asynchronous operations are executed one after the other in a separate thread
+    // derived classes can override this if the IPC method supports non-blocking operations natively
+    virtual std::future<Info> ImportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<Internals::DataContainer<double>> pData);
+
+    virtual std::future<Info> ExportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<const Internals::DataContainer<double>> pData);
+
+    std::future<Info> EnqueueAsyncOperation(std::function<Info()> Operation);
+
+    // enqueues an asynchronous export, which is done by the given function (in the asynchronous thread)
+    std::future<Info> EnqueueExportDataAsync(
+        const Info& I_Info,
+        std::function<Info()> Export);
+
+    void WaitForAsyncOperations();
+
     virtual Info ImportMeshImpl(
         const Info& I_Info,
         ModelPart& O_ModelPart);
@@ -234,11 +365,18 @@ protected:
 
         const auto start_time(std::chrono::steady_clock::now());
         StreamSerializer serializer(mSerializerTraceType);
-        serializer.save("object", rObject);
+        {
+            const Tracer::Scope trace_scope(mTracer, "serializer", "phase");
+            serializer.save("object", rObject);
+        }
         const double elapsed_time_save = Utilities::ElapsedSeconds(start_time);
 
         const std::string& data = serializer.GetStringRepresentation();
-        const double elapsed_time_write = SendString(I_Info, data);
+        double elapsed_time_write;
+        {
+            const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+            elapsed_time_write = SendString(I_Info, data);
+        }
 
         info.Set<double>("elapsed_time", elapsed_time_write+elapsed_time_save);
         info.Set<double>("elapsed_time_ipc", elapsed_time_write);
@@ -260,11 +398,18 @@ protected:
         Info info;
 
         std::string buffer;
-        const double elapsed_time_read = ReceiveString(I_Info, buffer);
+        double elapsed_time_read;
+        {
+            const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+            elapsed_time_read = ReceiveString(I_Info, buffer);
+        }
 
         const auto start_time(std::chrono::steady_clock::now());
-        StreamSerializer serializer(buffer, mSerializerTraceType);
-        serializer.load("object", rObject);
+        {
+            const Tracer::Scope trace_scope(mTracer, "serializer", "phase");
+            StreamSerializer serializer(buffer, mSerializerTraceType);
+            serializer.load("object", rObject);
+        }
         const double elapsed_time_load = Utilities::ElapsedSeconds(start_time);
 
         info.Set<double>("elapsed_time", elapsed_time_read+elapsed_time_load);
@@ -293,6 +438,18 @@ protected:
         const Info& I_Info,
         Internals::DataContainer<double>& rData) = 0;
 
+    // sends the header and the data of several buffers as one message
+    // by default the data is copied into one buffer, derived classes can override this to send directly from the buffers
+    virtual double SendDataBuffers(
+        const Info& I_Info,
+        const std::string& rHeader,
+        const std::vector<ConstDataBufferType>& rBuffers);
+
+    // rHeaderReceived is called with the received header and returns the buffers for the data, already allocated
+    virtual double ReceiveDataBuffers(
+        const Info& I_Info,
+        const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived);
+
 private:
     std::shared_ptr<DataCommunicator> mpDataComm;
 
@@ -301,20 +458,128 @@ private:
     std::string mConnectTo;
 
     Info mPartnerInfo;
+    int mPartnerSize = 0;
 
     fs::path mCommFolder;
     bool mCommInFolder = true;
     bool mAlwaysUseSerializer = false;
+    bool mUseIncrementalMeshExport = false;
+    bool mUseMeshCache = false;
     Serializer::TraceType mSerializerTraceType = Serializer::TraceType::SERIALIZER_NO_TRACE;
+    Compression::CompressionType mCompression = Compression::CompressionType::None;
 
     fs::path mWorkingDirectory;
     int mEchoLevel = 1;
     bool mIsPrimaryConnection;
     bool mPrimaryWasExplicitlySpecified;
     bool mPrintTiming = false;
+    bool mPrintStatistics = false;
+    std::string mTraceFile;
     bool mIsConnected = false;
 
-    void CheckConnection(const Info& I_Info);
+    Statistics mStatistics;
+    mutable Tracer mTracer; // mutable as also const functions are traced
+
+    std::thread mAsyncThread;
+    std::mutex mAsyncMutex;
+    std::condition_variable mAsyncTaskAvailable;
+    std::condition_variable mAsyncTasksFinished;
+    std::deque<std::function<void()>> mAsyncTasks;
+    std::size_t mNumPendingAsyncOperations = 0; // queued + running
+    bool mStopAsyncThread = false;
+
+    // hash of the topology of the last exported mesh, per identifier
+    std::unordered_map<std::string, std::size_t> mExportedMeshTopologies;
+
+    // the mesh cache, per identifier. Only hashes are kept, the importer keeps the mesh in the ModelPart it was imported into
+    // Both only exist as long as the connection, hence after reconnecting the mesh is transferred again
+    struct ExportedMesh
+    {
+        std::size_t Hash;
+        std::size_t TopologyHash;
+    };
+    struct ImportedMesh
+    {
+        std::size_t Hash;         // hash of the exported mesh, computed by the exporter
+        std::size_t ImportedHash; // hash of the ModelPart after importing the mesh
+    };
+    std::unordered_map<std::string, ExportedMesh> mExportedMeshes;
+    std::unordered_map<std::string, ImportedMesh> mImportedMeshes;
+
+    void AsyncThreadLoop();
+    void StopAsyncThread();
+
+    // if the partner runs with a different number of processes then the data is redistributed among my ranks
+    // such that only the ranks that have a partner rank communicate with the partner
+    Info ImportInfoFromPartnerRanks(const Info& I_Info);
+
+    Info ExportInfoToPartnerRanks(const Info& I_Info);
+
+    Info ImportDataFromPartnerRanks(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData);
+
+    Info ExportDataToPartnerRanks(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData);
+
+    // data of other types than double is always transferred directly (without serializer),
+    // its type is sent along and checked by the receiver
+    template<typename TDataType>
+    Info ImportDataFromPartnerRanks(
+        const Info& I_Info,
+        Internals::DataContainer<TDataType>& rData);
+
+    template<typename TDataType>
+    Info ExportDataToPartnerRanks(
+        const Info& I_Info,
+        const Internals::DataContainer<TDataType>& rData);
+
+    Info ImportDataBatchFromPartnerRanks(
+        const Info& I_Info,
+        const DataBatchType& rData);
+
+    Info ExportDataBatchToPartnerRanks(
+        const Info& I_Info,
+        const ConstDataBatchType& rData);
+
+    Info ImportMeshFromPartnerRanks(
+        const Info& I_Info,
+        ModelPart& O_ModelPart);
+
+    Info ExportMeshToPartnerRanks(
+        const Info& I_Info,
+        const ModelPart& I_ModelPart);
+
+    // the mesh is only transferred if the partner did not already receive the same mesh (compared by hash and size)
+    Info ImportMeshCached(
+        const Info& I_Info,
+        ModelPart& O_ModelPart);
+
+    Info ExportMeshCached(
+        const Info& I_Info,
+        const ModelPart& I_ModelPart);
+
+    // if the topology of the mesh did not change since the last export then only the coordinates of the nodes are transferred
+    // and applied to the previously imported ModelPart
+    Info ImportMeshIncremental(
+        const Info& I_Info,
+        ModelPart& O_ModelPart);
+
+    Info ExportMeshIncremental(
+        const Info& I_Info,
+        const ModelPart& I_ModelPart);
+
+    bool HasSameSizeAsPartner() const {return GetDataCommunicator().Size() == mPartnerSize;}
+
+    // ranks whose data is collected on this rank before exporting it to my partner rank
+    std::vector<int> GetRanksToCollectFrom() const;
+
+    // rank on which the data of this rank is collected before exporting it
+    int GetRankToCollectOn() const;
+
+    void CheckConnection(const Info& I_Info, const bool WaitForAsync=true);
+    void CheckAsyncIsPossible() const;
     void PostChecks(const Info& I_Info);
     virtual std::string GetCommunicationName() const = 0;
     virtual Info GetCommunicationSettings() const {return Info();}
@@ -329,7 +594,11 @@ private:
 
     virtual void DerivedHandShake() const {};
 
-    void PrintElapsedTime(
+    // collects the events of all ranks and writes them on rank 0
+    void WriteTrace() const;
+
+    // prints the elapsed time (if requested) and adds the operation to the statistics
+    void RecordElapsedTime(
         const Info& I_Info,
         const Info& O_Info,
         const std::string& rLabel);
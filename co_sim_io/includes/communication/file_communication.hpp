@@ -14,6 +14,8 @@
 #define CO_SIM_IO_FILE_COMMUNICATION_INCLUDED
 
 // System includes
+#include <string>
+#include <unordered_map>
 
 // Project includes
 #include "communication.hpp"
@@ -40,6 +42,13 @@ public:
 private:
     bool mUseAuxFileForFileAvailability = USE_AUX_FILE_FOR_FILE_AVAILABILITY;
     const bool mUseFileSerializer = true;
+    const bool mUseFileQueue = false;
+    const bool mUseMemoryMappedFiles = false; // the layout of the files is the same, hence the partners can use different settings
+
+    // counters for the sequence numbers in the file names, per identifier
+    // only used with "use_file_queue"
+    std::unordered_map<std::string, std::size_t> mSendCounters;
+    std::unordered_map<std::string, std::size_t> mReceiveCounters;
 
     std::string GetCommunicationName() const override {return "file";}
 
@@ -67,6 +76,13 @@ private:
         const Info& I_Info,
         const ModelPart& I_ModelPart) override;
 
+    fs::path GetDataFileName(
+        const Info& I_Info,
+        std::unordered_map<std::string, std::size_t>& rCounters) const;
+
+    // waits until the partner has read the previous file (unless the files are queued)
+    void WaitForPreviousSend(const fs::path& rPath) const;
+
     template<class TObjectType>
     Info GenericSendWithFileSerializer(
         const Info& I_Info,
@@ -104,6 +120,15 @@ private:
     double ReceiveDataContainer(
         const Info& I_Info,
         Internals::DataContainer<double>& rData) override;
+
+    double SendDataBuffers(
+        const Info& I_Info,
+        const std::string& rHeader,
+        const std::vector<ConstDataBufferType>& rBuffers) override;
+
+    double ReceiveDataBuffers(
+        const Info& I_Info,
+        const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived) override;
 };
 
 } // namespace Internals
@@ -40,6 +40,7 @@ public:
         const fs::path& rBasePipeName,
         const bool IsPrimary,
         const int BufferSize,
+        const bool UseVmsplice,
         const int EchoLevel);
 
     template<typename TDataType>
@@ -49,20 +50,17 @@ public:
 
         #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
         const std::size_t data_size = rData.size();
-        std::size_t written_size=0;
         SendSize(data_size); // serves also as synchronization for time measurement
 
         const auto start_time(std::chrono::steady_clock::now());
-        const std::size_t buffer_size = mBufferSize/SizeDataType;
-
-        while(written_size<data_size) {
-            const std::size_t data_left_to_write = data_size - written_size;
-            const std::size_t current_buffer_size = data_left_to_write > buffer_size ? buffer_size : data_left_to_write;
-
-            const ssize_t bytes_written = write(mPipeHandleWrite, &rData[written_size], current_buffer_size*SizeDataType);
-            CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe!" << std::endl;
-
-            written_size += current_buffer_size;
+        if (data_size > 0) {
+            const std::size_t num_bytes = data_size*SizeDataType;
+            if (UseVmsplice(num_bytes)) {
+                SpliceBuffers({{const_cast<char*>(reinterpret_cast<const char*>(&rData[0])), num_bytes}});
+                WaitForAcknowledgement();
+            } else {
+                WriteBytes(reinterpret_cast<const char*>(&rData[0]), num_bytes);
+            }
         }
         return Utilities::ElapsedSeconds(start_time);
         #else
@@ -80,20 +78,14 @@ public:
 
         #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
         std::size_t received_size = ReceiveSize(); // serves also as synchronization for time measurement
-        std::size_t read_size=0;
 
         const auto start_time(std::chrono::steady_clock::now());
         rData.resize(received_size);
-        const std::size_t buffer_size = mBufferSize/SizeDataType;
-
-        while(read_size<received_size) {
-            const std::size_t data_left_to_read = received_size - read_size;
-            const std::size_t current_buffer_size = data_left_to_read > buffer_size ? buffer_size : data_left_to_read;
-
-            const ssize_t bytes_written = read(mPipeHandleRead, &rData[read_size], current_buffer_size*SizeDataType);
-            CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in reading from Pipe!" << std::endl;
-
-            read_size += current_buffer_size;
+        if (received_size > 0) {
+            ReadBytes(reinterpret_cast<char*>(&rData[0]), received_size*SizeDataType);
+            if (UseVmsplice(received_size*SizeDataType)) {
+                SendAcknowledgement();
+            }
         }
         return Utilities::ElapsedSeconds(start_time);
         #else
@@ -104,6 +96,14 @@ public:
         CO_SIM_IO_CATCH
     }
 
+    // writes the header and the data with as few system calls as possible (gather)
+    double WriteBatch(
+        const std::string& rHeader,
+        const std::vector<ConstDataBufferType>& rBuffers);
+
+    // reads the header and then the data directly into the buffers (scatter)
+    double ReadBatch(const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived);
+
     void Close();
 
 
@@ -120,12 +120,35 @@ private:
     std::size_t mBufferSize;
     #endif
 
+    bool mUseVmsplice = false;
+
     void SendSize(const std::uint64_t Size);
 
     std::uint64_t ReceiveSize();
+
+    // read and write can transfer less than requested, hence they are called until everything is transferred
+    void WriteBytes(const char* pData, const std::size_t Size);
+
+    void ReadBytes(char* pData, const std::size_t Size);
+
+    // same as above, but for several buffers at once (writev/readv)
+    void WriteBuffers(const std::vector<std::pair<char*, std::size_t>>& rBuffers);
+
+    void ReadBuffers(const std::vector<std::pair<char*, std::size_t>>& rBuffers);
+
+    // with vmsplice the pages of large messages are mapped into the pipe instead of being copied into it (Linux only)
+    // the sender has to wait until the receiver acknowledges the reception, as the memory must not be modified before
+    bool UseVmsplice(const std::size_t NumBytes) const;
+
+    void SpliceBuffers(const std::vector<std::pair<char*, std::size_t>>& rBuffers);
+
+    void SendAcknowledgement();
+
+    void WaitForAcknowledgement();
 };
 
     const std::size_t mBufferSize;
+    const bool mUseVmsplice; // requested and supported, only used if the partner also uses it
 
     std::shared_ptr<BidirectionalPipe> mpPipe;
 
@@ -151,6 +174,15 @@ private:
         const Info& I_Info,
         Internals::DataContainer<double>& rData) override;
 
+    double SendDataBuffers(
+        const Info& I_Info,
+        const std::string& rHeader,
+        const std::vector<ConstDataBufferType>& rBuffers) override;
+
+    double ReceiveDataBuffers(
+        const Info& I_Info,
+        const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived) override;
+
     void DerivedHandShake() const override;
 
     Info GetCommunicationSettings() const override;
@@ -0,0 +1,134 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_SHARED_MEMORY_COMMUNICATION_INCLUDED
+#define CO_SIM_IO_SHARED_MEMORY_COMMUNICATION_INCLUDED
+
+// System includes
+#include <cstdint>
+
+// Project includes
+#include "communication.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+class CO_SIM_IO_API SharedMemoryCommunication : public Communication
+{
+public:
+    SharedMemoryCommunication(
+        const Info& I_Settings,
+        std::shared_ptr<DataCommunicator> I_DataComm);
+
+    ~SharedMemoryCommunication() override;
+
+private:
+// single-producer/single-consumer ring buffer living in a POSIX shared-memory segment
+// the read- and write-positions are only ever increased, hence no locking is required
+class RingBuffer
+{
+public:
+    RingBuffer(
+        const std::string& rName,
+        const std::size_t Capacity,
+        const bool Create);
+
+    template<typename TDataType>
+    double Write(const TDataType& rData, const std::size_t SizeDataType)
+    {
+        CO_SIM_IO_TRY
+
+        const std::uint64_t data_size = rData.size();
+        WriteBytes(reinterpret_cast<const char*>(&data_size), sizeof(data_size)); // serves also as synchronization for time measurement
+
+        const auto start_time(std::chrono::steady_clock::now());
+        if (data_size > 0) {
+            WriteBytes(reinterpret_cast<const char*>(&rData[0]), data_size*SizeDataType);
+        }
+        return Utilities::ElapsedSeconds(start_time);
+
+        CO_SIM_IO_CATCH
+    }
+
+    template<typename TDataType>
+    double Read(TDataType& rData, const std::size_t SizeDataType)
+    {
+        CO_SIM_IO_TRY
+
+        std::uint64_t received_size;
+        ReadBytes(reinterpret_cast<char*>(&received_size), sizeof(received_size)); // serves also as synchronization for time measurement
+
+        const auto start_time(std::chrono::steady_clock::now());
+        rData.resize(received_size);
+        if (received_size > 0) {
+            ReadBytes(reinterpret_cast<char*>(&rData[0]), received_size*SizeDataType);
+        }
+        return Utilities::ElapsedSeconds(start_time);
+
+        CO_SIM_IO_CATCH
+    }
+
+    // removes the name of the segment, the memory stays valid until it is unmapped by both partners
+    void Unlink();
+
+    void Close();
+
+private:
+    struct Header;
+
+    std::string mName;
+    std::size_t mCapacity;
+    std::size_t mMappedSize = 0;
+    Header* mpHeader = nullptr;
+    char* mpData = nullptr;
+
+    void WriteBytes(const char* pData, const std::size_t Size);
+
+    void ReadBytes(char* pData, const std::size_t Size);
+};
+
+    const std::size_t mBufferSize;
+
+    std::shared_ptr<RingBuffer> mpSendBuffer;
+    std::shared_ptr<RingBuffer> mpReceiveBuffer;
+
+    std::string GetCommunicationName() const override {return "shared_memory";}
+
+    Info ConnectDetail(const Info& I_Info) override;
+
+    Info DisconnectDetail(const Info& I_Info) override;
+
+    double SendString(
+        const Info& I_Info,
+        const std::string& rData) override;
+
+    double ReceiveString(
+        const Info& I_Info,
+        std::string& rData) override;
+
+    double SendDataContainer(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData) override;
+
+    double ReceiveDataContainer(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData) override;
+
+    void DerivedHandShake() const override;
+
+    Info GetCommunicationSettings() const override;
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_SHARED_MEMORY_COMMUNICATION_INCLUDED
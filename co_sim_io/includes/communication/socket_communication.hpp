@@ -37,14 +37,32 @@ private:
     unsigned short mPortNumber=0;
     std::string mIpAddress;
     std::string mSerializedConnectionInfo;
+    int mNumStreams;
+
+    // tuning of the sockets, the OS defaults are used if not specified
+    bool mTcpNoDelay;
+    int mSendBufferSize;
+    int mReceiveBufferSize;
+    int mBusyPoll;
+    bool mQuickAck;
 
     std::string GetCommunicationName() const override {return "socket";}
 
     void PrepareConnection(const Info& I_Info) override;
 
+    void DerivedHandShake() const override;
+
     Info GetCommunicationSettings() const override;
 
     void GetConnectionInformation();
+
+    void PrepareReceive() override;
+
+    void SetBufferSizes(asio::ip::tcp::socket& rSocket) const;
+
+    void SetSocketOptions(asio::ip::tcp::socket& rSocket) const;
+
+    Info GetSocketOptions(asio::ip::tcp::socket& rSocket) const;
 };
 
 } // namespace Internals
@@ -0,0 +1,54 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_COMPRESSION_INCLUDED
+#define CO_SIM_IO_COMPRESSION_INCLUDED
+
+// System includes
+#include <string>
+
+// Project includes
+#include "define.hpp"
+#include "data_container.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+namespace Compression {
+
+enum class CompressionType
+{
+    None,
+    Fpc
+};
+
+CompressionType CO_SIM_IO_API StringToCompressionType(const std::string& rCompression);
+
+std::string CO_SIM_IO_API CompressionTypeToString(const CompressionType Compression);
+
+// lossless compression of doubles with the FPC algorithm, see:
+// M. Burtscher and P. Ratanaworabhan, "FPC: A High-Speed Compressor for Double-Precision Floating-Point Data",
+// IEEE Transactions on Computers, vol. 58, no. 1, pp. 18-31, 2009
+// each value is predicted from the previous ones, only the (mostly zero) difference to the prediction is stored
+// this works best for smooth data, e.g. fields on the coupling interface
+std::string CO_SIM_IO_API CompressFpc(
+    const double* pData,
+    const std::size_t Size);
+
+void CO_SIM_IO_API DecompressFpc(
+    const std::string& rCompressedData,
+    DataContainer<double>& rData);
+
+} // namespace Compression
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_COMPRESSION_INCLUDED
@@ -51,6 +51,15 @@ public:
 
     Info Run(const Info& I_Info);
 
+    Info GetStatistics() const
+    {
+        return mpComm->GetStatistics();
+    }
+
+    std::shared_ptr<DataCommunicator> GetMergedDataCommunicator() const
+    {
+        return mpComm->GetMergedDataCommunicator();
+    }
 
     template<class... Args>
     Info ImportInfo(Args&&... args)
@@ -75,6 +84,30 @@ public:
         return mpComm->ExportData(std::forward<Args>(args)...);
     }
 
+    template<class... Args>
+    Info ImportDataBatch(Args&&... args)
+    {
+        return mpComm->ImportDataBatch(std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    Info ExportDataBatch(Args&&... args)
+    {
+        return mpComm->ExportDataBatch(std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    std::future<Info> ImportDataAsync(Args&&... args)
+    {
+        return mpComm->ImportDataAsync(std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    std::future<Info> ExportDataAsync(Args&&... args)
+    {
+        return mpComm->ExportDataAsync(std::forward<Args>(args)...);
+    }
+
     template<class... Args>
     Info ImportMesh(Args&&... args)
     {
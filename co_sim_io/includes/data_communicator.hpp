@@ -539,6 +539,14 @@ class DataCommunicator
         return false;
     }
 
+    /// Check whether this DataCommunicator can be used from several threads at the same time.
+    /** In MPI, this requires that MPI was initialized with MPI_THREAD_MULTIPLE.
+     */
+    virtual bool IsThreadSafe() const
+    {
+        return true;
+    }
+
     ///@}
     ///@name Helper functions for error checking in MPI
     ///@{
@@ -15,6 +15,9 @@
 
 // System includes
 #include <vector>
+#include <string>
+#include <complex>
+#include <cstdint>
 #include <algorithm> // std::max
 #include <ostream>
 
@@ -25,6 +28,56 @@
 namespace CoSimIO {
 namespace Internals {
 
+// types of values that can be exchanged
+// the values are part of the communication protocol and must not be changed
+enum class DataType : std::uint8_t
+{
+    Double        = 0,
+    Float         = 1,
+    Int32         = 2,
+    Int64         = 3,
+    ComplexDouble = 4
+};
+
+template<typename TDataType> struct DataTypeTraits;
+
+template<> struct DataTypeTraits<double>
+{
+    static DataType Type() {return DataType::Double;}
+};
+
+template<> struct DataTypeTraits<float>
+{
+    static DataType Type() {return DataType::Float;}
+};
+
+template<> struct DataTypeTraits<std::int32_t>
+{
+    static DataType Type() {return DataType::Int32;}
+};
+
+template<> struct DataTypeTraits<std::int64_t>
+{
+    static DataType Type() {return DataType::Int64;}
+};
+
+template<> struct DataTypeTraits<std::complex<double>>
+{
+    static DataType Type() {return DataType::ComplexDouble;}
+};
+
+inline std::string DataTypeToString(const DataType Type)
+{
+    switch (Type) {
+        case DataType::Double:        return "double";
+        case DataType::Float:         return "float";
+        case DataType::Int32:         return "int32";
+        case DataType::Int64:         return "int64";
+        case DataType::ComplexDouble: return "complex_double";
+    }
+    return "unknown (" + std::to_string(static_cast<int>(Type)) + ")";
+}
+
 template<typename TDataType>
 class DataContainer
 {
@@ -64,9 +117,7 @@ private:
         CO_SIM_IO_TRY
 
         rSerializer.save("size", size());
-        for (std::size_t i=0; i<size(); ++i) {
-            rSerializer.save("v", data()[i]);
-        }
+        rSerializer.save_array("values", data(), size());
 
         CO_SIM_IO_CATCH
     }
@@ -81,9 +132,7 @@ private:
             resize(new_size);
         }
 
-        for (std::size_t i=0; i<size(); ++i) {
-            rSerializer.load("v", data()[i]);
-        }
+        rSerializer.load_array("values", data(), size());
 
         CO_SIM_IO_CATCH
     }
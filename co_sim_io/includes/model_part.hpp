@@ -22,6 +22,7 @@ see https://github.com/KratosMultiphysics/Kratos/blob/master/kratos/includes/mod
 
 // System includes
 #include <vector>
+#include <deque>
 #include <string>
 #include <unordered_map>
 #include <atomic>
@@ -79,6 +80,9 @@ private:
 };
 
 
+// vector with fast access to the entries by their Id
+// often the Ids are consecutive (e.g. 1,2,3,...), in this case the index is computed directly from the Id
+// the (memory intensive) map from Id to index is only created once the Ids are no longer consecutive
 template<class TDataType>
 class IndexedVector
 {
@@ -101,30 +105,36 @@ public:
     void reserve(std::size_t NewCapacity)
     {
         mData.reserve(NewCapacity);
-        mAccessMap.reserve(NewCapacity);
+        if (!mIdsAreConsecutive) {
+            mAccessMap.reserve(NewCapacity);
+        }
     }
 
     const ContainerType& data() const {return mData;}
 
-    bool contains(CoSimIO::IdType Id) const {return mAccessMap.count(Id) > 0;}
+    bool contains(CoSimIO::IdType Id) const
+    {
+        std::size_t index;
+        return GetIndex(Id, index);
+    }
 
     iterator find(CoSimIO::IdType Id)
     {
-        const auto it_index = mAccessMap.find(Id);
-        if (it_index == mAccessMap.end()) {
-            return mData.end();
+        std::size_t index;
+        if (GetIndex(Id, index)) {
+            return mData.begin()+index;
         } else {
-            return mData.begin()+it_index->second;
+            return mData.end();
         }
     }
 
     const_iterator find(CoSimIO::IdType Id) const
     {
-        const auto it_index = mAccessMap.find(Id);
-        if (it_index == mAccessMap.end()) {
-            return mData.end();
+        std::size_t index;
+        if (GetIndex(Id, index)) {
+            return mData.begin()+index;
         } else {
-            return mData.begin()+it_index->second;
+            return mData.end();
         }
     }
 
@@ -132,6 +142,7 @@ public:
     {
         mData.clear();
         mAccessMap.clear();
+        mIdsAreConsecutive = true;
     }
 
     void shrink_to_fit()
@@ -141,20 +152,70 @@ public:
 
     void push_back(const TDataType& rData, CoSimIO::IdType Id)
     {
+        if (mIdsAreConsecutive) {
+            if (mData.empty()) {
+                mFirstId = Id;
+            } else if (Id != mFirstId + static_cast<CoSimIO::IdType>(mData.size())) {
+                CreateAccessMapFromConsecutiveIds(mData.size());
+            }
+        }
+
         mData.push_back(rData);
-        mAccessMap[Id] = mData.size()-1;
+
+        if (!mIdsAreConsecutive) {
+            mAccessMap[Id] = mData.size()-1;
+        }
     }
 
 private:
     ContainerType mData;
-    std::unordered_map<CoSimIO::IdType, std::size_t> mAccessMap;
+    bool mIdsAreConsecutive = true;
+    CoSimIO::IdType mFirstId = 0; // only used if the Ids are consecutive
+    std::unordered_map<CoSimIO::IdType, std::size_t> mAccessMap; // only used if the Ids are not consecutive
+
+    bool GetIndex(CoSimIO::IdType Id, std::size_t& rIndex) const
+    {
+        if (mIdsAreConsecutive) {
+            if (Id < mFirstId || Id >= mFirstId + static_cast<CoSimIO::IdType>(mData.size())) {
+                return false;
+            }
+            rIndex = static_cast<std::size_t>(Id - mFirstId);
+            return true;
+        }
+
+        const auto it_index = mAccessMap.find(Id);
+        if (it_index == mAccessMap.end()) {
+            return false;
+        }
+        rIndex = it_index->second;
+        return true;
+    }
+
+    // creates the map for the first "NumEntries" entries, which have consecutive Ids
+    void CreateAccessMapFromConsecutiveIds(const std::size_t NumEntries)
+    {
+        mIdsAreConsecutive = false;
+        mAccessMap.reserve(mData.capacity());
+        for (std::size_t i=0; i<NumEntries; ++i) {
+            mAccessMap[mFirstId + static_cast<CoSimIO::IdType>(i)] = i;
+        }
+    }
 
     void ComputeAccessMap()
     {
         mAccessMap.clear();
-        mAccessMap.reserve(mData.size());
+        mIdsAreConsecutive = true;
+        if (!mData.empty()) {
+            mFirstId = mData[0]->Id();
+        }
+
         for (std::size_t i=0; i<mData.size(); ++i) {
-            mAccessMap[mData[i]->Id()] = i;
+            if (mIdsAreConsecutive && mData[i]->Id() != mFirstId + static_cast<CoSimIO::IdType>(i)) {
+                CreateAccessMapFromConsecutiveIds(i);
+            }
+            if (!mIdsAreConsecutive) {
+                mAccessMap[mData[i]->Id()] = i;
+            }
         }
     }
 
@@ -172,8 +233,68 @@ private:
     }
 };
 
+
+// the data of the nodes is stored as structure of arrays
+// this way the coordinates are contiguous in memory and creating a node does not require an own allocation
+struct NodesData
+{
+    std::vector<CoSimIO::IdType> Ids;
+    std::vector<double> X;
+    std::vector<double> Y;
+    std::vector<double> Z;
+    std::vector<int> PartitionIndices; // -1 for local nodes
+
+    std::size_t size() const {return Ids.size();}
+
+    void reserve(const std::size_t NewCapacity)
+    {
+        Ids.reserve(NewCapacity);
+        X.reserve(NewCapacity);
+        Y.reserve(NewCapacity);
+        Z.reserve(NewCapacity);
+        PartitionIndices.reserve(NewCapacity);
+    }
+
+    void push_back(
+        const CoSimIO::IdType I_Id,
+        const double I_X,
+        const double I_Y,
+        const double I_Z,
+        const int PartitionIndex)
+    {
+        Ids.push_back(I_Id);
+        X.push_back(I_X);
+        Y.push_back(I_Y);
+        Z.push_back(I_Z);
+        PartitionIndices.push_back(PartitionIndex);
+    }
+
+    void clear()
+    {
+        Ids.clear();
+        X.clear();
+        Y.clear();
+        Z.clear();
+        PartitionIndices.clear();
+    }
+
+    void shrink_to_fit()
+    {
+        Ids.shrink_to_fit();
+        X.shrink_to_fit();
+        Y.shrink_to_fit();
+        Z.shrink_to_fit();
+        PartitionIndices.shrink_to_fit();
+    }
+};
+
+class NodesStorage;
+
 } //namespace Internals
 
+// a Node refers to an entry in NodesData
+// Nodes that are created by a ModelPart refer to the NodesStorage of the ModelPart, which is kept alive by its Nodes
+// Nodes that are created on their own own their data
 class CO_SIM_IO_API Node
 {
 public:
@@ -189,43 +310,60 @@ public:
     : Node(I_Id, I_Coordinates[0], I_Coordinates[1], I_Coordinates[2])
     { }
 
+    // used by the ModelPart, the data is not owned by the Node
+    Node(
+        Internals::NodesStorage& rStorage,
+        Internals::NodesData& rData,
+        const std::size_t Index)
+    : mpStorage(&rStorage), mpData(&rData), mIndex(Index)
+    { }
+
+    ~Node();
+
     // delete copy and assignment CTor
     Node(const Node&) = delete;
     Node& operator=(Node const&) = delete;
 
-    IdType Id() const { return mId; }
-    double X() const { return mX; }
-    double Y() const { return mY; }
-    double Z() const { return mZ; }
-    CoordinatesType Coordinates() const { return {mX, mY, mZ}; }
+    IdType Id() const { return mpData->Ids[mIndex]; }
+    double X() const { return mpData->X[mIndex]; }
+    double Y() const { return mpData->Y[mIndex]; }
+    double Z() const { return mpData->Z[mIndex]; }
+    CoordinatesType Coordinates() const { return {X(), Y(), Z()}; }
+
+    void SetCoordinates(
+        const double I_X,
+        const double I_Y,
+        const double I_Z)
+    {
+        mpData->X[mIndex] = I_X;
+        mpData->Y[mIndex] = I_Y;
+        mpData->Z[mIndex] = I_Z;
+    }
+
+    void SetCoordinates(const CoordinatesType& I_Coordinates)
+    {
+        SetCoordinates(I_Coordinates[0], I_Coordinates[1], I_Coordinates[2]);
+    }
 
     void Print(std::ostream& rOStream) const;
 
 private:
-    IdType mId;
-    double mX;
-    double mY;
-    double mZ;
+    std::unique_ptr<Internals::NodesData> mpOwnData; // only used if the Node is not created by a ModelPart
+    Internals::NodesStorage* mpStorage = nullptr; // only used if the Node is created by a ModelPart
+    Internals::NodesData* mpData;
+    std::size_t mIndex = 0;
 
     //*********************************************
     //this block is needed for refcounting
+    // the Nodes of a ModelPart are counted (and deleted) together with their NodesStorage
     mutable std::atomic<int> mReferenceCounter{0};
 
-    friend void intrusive_ptr_add_ref(const Node* x)
-    {
-        x->mReferenceCounter.fetch_add(1, std::memory_order_relaxed);
-    }
+    friend void intrusive_ptr_add_ref(const Node* x);
 
-    friend void intrusive_ptr_release(const Node* x)
-    {
-        if (x->mReferenceCounter.fetch_sub(1, std::memory_order_release) == 1) {
-            std::atomic_thread_fence(std::memory_order_acquire);
-            delete x;
-        }
-    }
+    friend void intrusive_ptr_release(const Node* x);
     //*********************************************
 
-    Node() = default; // needed for Serializer
+    Node() : Node(1, 0.0, 0.0, 0.0) {} // needed for Serializer
 
     friend class CoSimIO::Internals::Serializer; // needs "CoSimIO::Internals::" because it is in different namespace
 
@@ -243,6 +381,69 @@ inline std::ostream & operator <<(
     return rOStream;
 }
 
+namespace Internals {
+
+// the nodal data of a ModelPart together with the Nodes referring to it
+// the Nodes are stored in a deque, as they must not be moved
+class NodesStorage
+{
+public:
+    NodesData Data;
+    std::deque<Node> Nodes;
+
+    Node& AddNode(
+        const CoSimIO::IdType I_Id,
+        const double I_X,
+        const double I_Y,
+        const double I_Z,
+        const int PartitionIndex)
+    {
+        Data.push_back(I_Id, I_X, I_Y, I_Z, PartitionIndex);
+        Nodes.emplace_back(*this, Data, Data.size()-1);
+        return Nodes.back();
+    }
+
+private:
+    //*********************************************
+    //this block is needed for refcounting
+    mutable std::atomic<int> mReferenceCounter{0};
+
+    friend void intrusive_ptr_add_ref(const NodesStorage* x)
+    {
+        x->mReferenceCounter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    friend void intrusive_ptr_release(const NodesStorage* x)
+    {
+        if (x->mReferenceCounter.fetch_sub(1, std::memory_order_release) == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            delete x;
+        }
+    }
+    //*********************************************
+};
+
+} //namespace Internals
+
+inline void intrusive_ptr_add_ref(const Node* x)
+{
+    if (x->mpStorage) {
+        intrusive_ptr_add_ref(x->mpStorage);
+    } else {
+        x->mReferenceCounter.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+inline void intrusive_ptr_release(const Node* x)
+{
+    if (x->mpStorage) {
+        intrusive_ptr_release(x->mpStorage);
+    } else if (x->mReferenceCounter.fetch_sub(1, std::memory_order_release) == 1) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        delete x;
+    }
+}
+
 
 class CO_SIM_IO_API Element
 {
@@ -426,6 +627,7 @@ protected:
 
 private:
     std::string mName;
+    CoSimIO::intrusive_ptr<Internals::NodesStorage> mpNodesStorage; // data of all nodes, local and ghost, created when the first node is added
     NodesContainerType mNodes; // contains all nodes, local and ghost
     ElementsContainerType mElements; // contains all elements, local and ghost
 
@@ -447,6 +649,15 @@ private:
 
     bool HasNode(const IdType I_Id) const;
 
+    Internals::NodesStorage& GetNodesStorage();
+
+    NodePointerType AddNode(
+        const IdType I_Id,
+        const double I_X,
+        const double I_Y,
+        const double I_Z,
+        const int PartitionIndex);
+
     bool HasElement(const IdType I_Id) const;
 
     ModelPart& GetLocalModelPart();
@@ -484,6 +695,7 @@ inline void ModelPart::CreateNewNodes(
     CO_SIM_IO_ERROR_IF(num_new_nodes != I_Y.size()) << "Wrong number of Y-Coordinates!" << std::endl;
     CO_SIM_IO_ERROR_IF(num_new_nodes != I_Z.size()) << "Wrong number of Z-Coordinates!" << std::endl;
 
+    GetNodesStorage().Data.reserve(GetNodesStorage().Data.size()+num_new_nodes);
     mNodes.reserve(mNodes.size()+num_new_nodes);
     GetLocalModelPart().mNodes.reserve(GetLocalModelPart().mNodes.size()+num_new_nodes);
 
@@ -513,6 +725,7 @@ inline void ModelPart::CreateNewGhostNodes(
     CO_SIM_IO_ERROR_IF(num_new_nodes != I_Z.size()) << "Wrong number of Z-Coordinates!" << std::endl;
     CO_SIM_IO_ERROR_IF(num_new_nodes != PartitionIndex.size()) << "Wrong number of partition indices!" << std::endl;
 
+    GetNodesStorage().Data.reserve(GetNodesStorage().Data.size()+num_new_nodes);
     mNodes.reserve(mNodes.size()+num_new_nodes);
     GetGhostModelPart().mNodes.reserve(GetGhostModelPart().mNodes.size()+num_new_nodes);
     // preparing the sizes in the PartitionModelParts requires to compute how many nodes go to which partition
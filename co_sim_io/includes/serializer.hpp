@@ -25,8 +25,10 @@
 #include <fstream>
 #include <memory>
 #include <array>
+#include <complex>
 #include <vector>
 #include <utility>
+#include <type_traits>
 
 // Project includes
 #include "define.hpp"
@@ -383,8 +385,17 @@ public:
 
         rObject.resize(size);
 
-        for (SizeType i = 0 ; i < size ; i++)
-            load("E", rObject[i]);
+        load_vector_values(rObject, IsContiguousType<TDataType>());
+    }
+
+    /// Loads an array of basic types that was saved with save_array.
+    /// The memory must already be allocated, the size is not read (must be saved/loaded separately)
+    template<class TDataType>
+    void load_array(std::string const & rTag, TDataType* pData, const SizeType Size)
+    {
+        static_assert(IsContiguousType<TDataType>::value, "Only basic types can be loaded as arrays!");
+        load_trace_point(rTag);
+        read(pData, Size);
     }
 
     template<class TKeyType, class TDataType>
@@ -441,8 +452,18 @@ public:
 
         save("size", size);
 
-        for (SizeType i = 0 ; i < size ; i++)
-            save("E", rObject[i]);
+        save_vector_values(rObject, IsContiguousType<TDataType>());
+    }
+
+    /// Saves an array of basic types with one write in the binary format (and only one trace tag)
+    /// This is much faster than saving each value individually
+    /// The size is not saved (must be saved/loaded separately)
+    template<class TDataType>
+    void save_array(std::string const & rTag, const TDataType* pData, const SizeType Size)
+    {
+        static_assert(IsContiguousType<TDataType>::value, "Only basic types can be saved as arrays!");
+        save_trace_point(rTag);
+        write(pData, Size);
     }
 
     template<class TKeyType, class TDataType>
@@ -670,6 +691,41 @@ private:
     ///@name Private Operations
     ///@{
 
+    // basic types which can be written/read directly as a block of memory
+    // bool is excluded since std::vector<bool> does not store its values contiguously
+    template<class TDataType>
+    struct IsContiguousType : std::integral_constant<bool,
+        std::is_arithmetic<TDataType>::value && !std::is_same<TDataType, bool>::value> {};
+
+    template<class TDataType>
+    struct IsContiguousType<std::complex<TDataType>> : IsContiguousType<TDataType> {};
+
+    template<class TDataType>
+    void save_vector_values(std::vector<TDataType> const& rObject, std::true_type)
+    {
+        save_array("E", rObject.data(), rObject.size());
+    }
+
+    template<class TDataType>
+    void save_vector_values(std::vector<TDataType> const& rObject, std::false_type)
+    {
+        for (SizeType i = 0 ; i < rObject.size() ; i++)
+            save("E", rObject[i]);
+    }
+
+    template<class TDataType>
+    void load_vector_values(std::vector<TDataType>& rObject, std::true_type)
+    {
+        load_array("E", rObject.data(), rObject.size());
+    }
+
+    template<class TDataType>
+    void load_vector_values(std::vector<TDataType>& rObject, std::false_type)
+    {
+        for (SizeType i = 0 ; i < rObject.size() ; i++)
+            load("E", rObject[i]);
+    }
+
     template<class TDataType>
     void SavePointer(std::string const & rTag, const TDataType * pValue)
     {
@@ -827,82 +883,37 @@ private:
     }
 
     template<class TDataType>
-    void read(std::vector<TDataType>& rData)
-    {
-        CO_SIM_IO_SERIALIZER_MODE_BINARY
-
-        SizeType size;
-        mpBuffer->read((char *)(&size),sizeof(SizeType));
-
-        rData.resize(size);
-
-        read(rData.begin(), rData.end(), sizeof(TDataType));
-
-        CO_SIM_IO_SERIALIZER_MODE_ASCII
-
-        std::size_t size;
-        *mpBuffer >> size;
-        rData.resize(size);
-        mNumberOfLines++;
-
-        read(rData.begin(), rData.end());
-
-        CO_SIM_IO_SERIALIZER_MODE_END
-    }
-
-    template<class TDataType>
-    void write(std::vector<TDataType> const& rData)
-    {
-        CO_SIM_IO_SERIALIZER_MODE_BINARY
-
-        SizeType rData_size = rData.size();
-
-        const char * data = reinterpret_cast<const char *>(&rData_size);
-        mpBuffer->write(data,sizeof(SizeType));
-
-        write(rData.begin(), rData.end(), sizeof(TDataType));
-
-        CO_SIM_IO_SERIALIZER_MODE_ASCII
-
-        *mpBuffer << rData.size() << std::endl;
-        write(rData.begin(), rData.end());
-
-        CO_SIM_IO_SERIALIZER_MODE_END
-    }
-
-    template<class TIteratorType>
-    void read(TIteratorType First, TIteratorType Last, SizeType size)
+    void read(TDataType* pData, const SizeType Size)
     {
         CO_SIM_IO_SERIALIZER_MODE_BINARY
 
-        for (; First != Last ; First++) {
-            mpBuffer->read((char *)First,sizeof(size));
+        if (Size > 0) {
+            mpBuffer->read(reinterpret_cast<char*>(pData), Size*sizeof(TDataType));
         }
 
         CO_SIM_IO_SERIALIZER_MODE_ASCII
 
-        for (; First != Last ; First++) {
-            *mpBuffer >> *First;
+        for (SizeType i = 0; i < Size; ++i) {
+            *mpBuffer >> pData[i];
             mNumberOfLines++;
         }
 
         CO_SIM_IO_SERIALIZER_MODE_END
     }
 
-    template<class TIteratorType>
-    void write(TIteratorType First, TIteratorType Last, SizeType size)
+    template<class TDataType>
+    void write(const TDataType* pData, const SizeType Size)
     {
         CO_SIM_IO_SERIALIZER_MODE_BINARY
 
-        for (; First != Last ; First++) {
-            const char * data = reinterpret_cast<const char *>(First);
-            mpBuffer->write(data,sizeof(size));
+        if (Size > 0) {
+            mpBuffer->write(reinterpret_cast<const char*>(pData), Size*sizeof(TDataType));
         }
 
         CO_SIM_IO_SERIALIZER_MODE_ASCII
 
-        for (; First != Last ; First++) {
-            *mpBuffer << *First << std::endl;
+        for (SizeType i = 0; i < Size; ++i) {
+            *mpBuffer << pData[i] << std::endl;
         }
 
         CO_SIM_IO_SERIALIZER_MODE_END
@@ -0,0 +1,94 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_STATISTICS_INCLUDED
+#define CO_SIM_IO_STATISTICS_INCLUDED
+
+// System includes
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Project includes
+#include "define.hpp"
+#include "info.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+// histogram of durations with logarithmically spaced bins
+// the bins cover 0.1 microseconds to ~4 hours with a relative width of ~9%,
+// this is the accuracy of the percentiles. Min, max and mean are exact.
+class CO_SIM_IO_API DurationHistogram
+{
+public:
+    DurationHistogram();
+
+    void Add(const double Duration);
+
+    std::size_t Count() const {return mCount;}
+    double Total() const {return mTotal;}
+    double Min() const {return mMin;}
+    double Max() const {return mMax;}
+    double Mean() const;
+
+    // Fraction must be in [0, 1], e.g. 0.99 for the 99th percentile
+    double Percentile(const double Fraction) const;
+
+private:
+    std::vector<std::size_t> mBins;
+    std::size_t mCount = 0;
+    double mTotal = 0.0;
+    double mMin = 0.0;
+    double mMax = 0.0;
+};
+
+// collects the timings and transferred bytes of the operations of a connection
+// per operation (e.g. "export_data") and identifier
+// thread-safe, as the asynchronous operations are recorded from a separate thread
+class CO_SIM_IO_API Statistics
+{
+public:
+    // I_Info is the Info returned by the operation
+    void Record(
+        const std::string& rOperation,
+        const std::string& rIdentifier,
+        const Info& I_Info);
+
+    void Clear();
+
+    // layout: operation => identifier => entries
+    Info GetInfo() const;
+
+    void Print(std::ostream& rOStream) const;
+
+private:
+    struct Entry
+    {
+        DurationHistogram ElapsedTime;
+        double ElapsedTimeIpc = 0.0;
+        double ElapsedTimeSerializer = 0.0;
+        std::size_t MemoryUsageIpc = 0;
+    };
+
+    // ordered, such that the output is sorted
+    std::map<std::pair<std::string, std::string>, Entry> mEntries;
+    mutable std::mutex mMutex;
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_STATISTICS_INCLUDED
@@ -0,0 +1,112 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_TRACER_INCLUDED
+#define CO_SIM_IO_TRACER_INCLUDED
+
+// System includes
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project includes
+#include "define.hpp"
+#include "filesystem_inc.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+// records the begin and duration of the operations of a connection
+// the events are written in the Chrome trace event format, which can be viewed with chrome://tracing or https://ui.perfetto.dev
+// the wall clock is used for the timestamps, such that the traces of the coupled solvers can be merged and compared
+// thread-safe, as the asynchronous operations are recorded from a separate thread
+class CO_SIM_IO_API Tracer
+{
+public:
+    using ClockType = std::chrono::system_clock;
+
+    // records an event from its construction until its destruction
+    // does nothing if the tracer is disabled
+    class CO_SIM_IO_API Scope
+    {
+    public:
+        Scope(
+            Tracer& rTracer,
+            const std::string& rName,
+            const std::string& rCategory,
+            const std::string& rIdentifier="");
+
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Tracer* mpTracer = nullptr; // nullptr if the tracer is disabled
+        std::string mName;
+        std::string mCategory;
+        std::string mIdentifier;
+        ClockType::time_point mStartTime;
+    };
+
+    // the process name is shown for the events, e.g. the name of the solver
+    Tracer(
+        const bool IsEnabled,
+        const std::string& rProcessName);
+
+    bool IsEnabled() const {return mIsEnabled;}
+
+    void AddEvent(
+        const std::string& rName,
+        const std::string& rCategory,
+        const std::string& rIdentifier,
+        const ClockType::time_point StartTime,
+        const ClockType::time_point EndTime);
+
+    void Clear();
+
+    std::size_t NumEvents() const;
+
+    // events of this rank as comma separated JSON objects, to be collected from all ranks before writing
+    std::string GetEventsJson(const int Rank) const;
+
+    // writes the events of all ranks, as returned by GetEventsJson
+    void WriteChromeTrace(
+        const fs::path& rFileName,
+        const std::vector<std::string>& rEventsJsonOfRanks) const;
+
+private:
+    struct Event
+    {
+        std::string Name;
+        std::string Category;
+        std::string Identifier;
+        std::thread::id ThreadId;
+        std::int64_t StartTime; // [ns] since epoch
+        std::int64_t Duration;  // [ns]
+    };
+
+    const bool mIsEnabled;
+    const std::string mProcessName;
+    const int mProcessId; // derived from the process name, such that the traces of the partners can be merged
+
+    std::vector<Event> mEvents;
+    mutable std::mutex mMutex;
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_TRACER_INCLUDED
@@ -49,8 +49,11 @@ int CO_SIM_IO_API GetNumberOfNodesForElementType(const ElementType I_ElementType
 
 std::string CO_SIM_IO_API GetElementName(const ElementType I_ElementType);
 
+// blocking wait, uses notifications of the filesystem if available (inotify on Linux)
 void CO_SIM_IO_API WaitUntilPathExists(const fs::path& rPath);
 
+void CO_SIM_IO_API WaitUntilPathIsRemoved(const fs::path& rPath);
+
 std::set<std::size_t> CO_SIM_IO_API ComputePartnerRanksAsImporter(
     const std::size_t MyRank,
     const std::size_t MySize,
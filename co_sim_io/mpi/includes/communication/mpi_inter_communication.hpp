@@ -14,6 +14,9 @@
 #define CO_SIM_IO_MPI_INTER_COMMUNICATION_INCLUDED
 
 // System includes
+#include <chrono>
+#include <unordered_map>
+#include <vector>
 
 // External includes
 #include "mpi.h"
@@ -57,13 +60,76 @@ public:
         const Info& I_Info,
         Internals::DataContainer<double>& rData) override;
 
+    // the send is posted right away (non-blocking), the asynchronous thread only waits for its completion
+    std::future<Info> ExportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<const Internals::DataContainer<double>> pData) override;
+
+    // only available if the communicators are merged
+    std::shared_ptr<DataCommunicator> GetMergedDataCommunicator() const override;
+
+protected:
+    // the intercommunicator is merged into an intracommunicator, in which the ranks of the primary connection come first
+    virtual bool GetMergeCommunicators() const {return mMergeCommunicators;}
+
+    MPI_Comm GetMergedCommunicator() const {return mMergedComm;}
+
 private:
+    // persistent requests for the data that is exchanged repeatedly under the same identifier
+    // each identifier uses its own tag, assigned in the order of the first exchange (which is the same on both sides)
+    struct PersistentSend
+    {
+        int Tag;
+        std::size_t Size = 0; // size of the receive that the partner has pre-posted, 0 if none
+        const double* pData = nullptr; // the request is bound to the buffer it was created with
+        MPI_Request Request = MPI_REQUEST_NULL;
+    };
+
+    struct PersistentReceive
+    {
+        int Tag;
+        std::vector<double> Buffer; // pre-posted before the container of the next import is known
+        MPI_Request Request = MPI_REQUEST_NULL;
+    };
+
+    struct PostedSend
+    {
+        std::vector<MPI_Request> Requests;
+        std::chrono::steady_clock::time_point StartTime;
+    };
+
     MPI_Comm mInterComm;
     std::string mPortName;
+    const bool mUsePersistentRequests;
+    const bool mMergeCommunicators;
+
+    MPI_Comm mMergedComm = MPI_COMM_NULL;
+    MPI_Comm mUserMergedComm = MPI_COMM_NULL; // duplicate of the merged communicator that is given to the user
+    std::shared_ptr<DataCommunicator> mpMergedDataComm;
+
+    std::unordered_map<std::string, PersistentSend> mPersistentSends;
+    std::unordered_map<std::string, PersistentReceive> mPersistentReceives;
 
     void PrepareConnection(const Info& I_Info) override;
 
     Info GetCommunicationSettings() const override;
+
+    void DerivedHandShake() const override;
+
+    // the data must not be modified until the send is completed
+    // persistent requests are only used for blocking sends, as they cannot be started again while they are active
+    PostedSend PostSendDataContainer(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData,
+        const bool UsePersistentRequest);
+
+    void WaitForPostedSend(PostedSend& rPostedSend);
+
+    double ReceiveDataContainerPersistent(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData);
+
+    void FreePersistentRequests();
 };
 
 #endif // CO_SIM_IO_BUILD_MPI_COMMUNICATION
@@ -0,0 +1,111 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_MPI_RMA_COMMUNICATION_INCLUDED
+#define CO_SIM_IO_MPI_RMA_COMMUNICATION_INCLUDED
+
+// System includes
+#include <unordered_map>
+#include <vector>
+
+// External includes
+#include "mpi.h"
+
+// Project includes
+#include "mpi/includes/communication/mpi_inter_communication.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+#ifdef CO_SIM_IO_BUILD_MPI_COMMUNICATION
+
+// The connection is established like for the MPIInterCommunication, the data is then written
+// with one-sided communication (MPI_Put) into a staging buffer that the importer has exposed
+// in a (dynamic) window. The access to this staging buffer is synchronized with two-sided
+// "ready" and "done" messages, and the importer copies the data out of it afterwards.
+// Hence this is not faster than the MPIInterCommunication, see the docs for measurements.
+class CO_SIM_IO_API MPIRMACommunication : public MPIInterCommunication
+{
+public:
+    using BaseType = MPIInterCommunication;
+
+    MPIRMACommunication(
+        const Info& I_Settings,
+        std::shared_ptr<DataCommunicator> I_DataComm)
+        : BaseType(I_Settings, I_DataComm) {}
+
+    ~MPIRMACommunication() override;
+
+    std::string GetCommunicationName() const override {return "mpi_rma";}
+
+    Info ConnectDetail(const Info& I_Info) override;
+
+    Info DisconnectDetail(const Info& I_Info) override;
+
+    double SendDataContainer(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData) override;
+
+    double ReceiveDataContainer(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData) override;
+
+    // the data is put in the asynchronous thread, as the buffer of the importer might not be ready yet
+    std::future<Info> ExportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<const Internals::DataContainer<double>> pData) override;
+
+protected:
+    // one-sided communication requires an intracommunicator
+    bool GetMergeCommunicators() const override {return true;}
+
+private:
+    // the synchronization messages of each identifier use their own tags, assigned in the order of the
+    // first exchange (which is the same on both sides)
+    // the synchronization messages are sent non-blocking, the send is completed before the message
+    // buffer is reused (in the next exchange) or when disconnecting
+    struct ExportedData
+    {
+        int Tag;
+        MPI_Aint Done[2]; // size of the data and whether the buffer has to be resized
+        MPI_Request DoneRequest = MPI_REQUEST_NULL;
+    };
+
+    struct ImportedData
+    {
+        int Tag;
+        std::vector<double> Buffer; // attached to the window, the exporter puts the data into it
+        MPI_Aint Ready[2]; // address and capacity of the buffer
+        MPI_Request ReadyRequest = MPI_REQUEST_NULL;
+    };
+
+    MPI_Win mWindow = MPI_WIN_NULL;
+    int mMyRank; // rank in the merged communicator
+    int mPartnerRank; // rank of my partner rank in the merged communicator
+
+    std::unordered_map<std::string, ExportedData> mExportedData;
+    std::unordered_map<std::string, ImportedData> mImportedData;
+
+    void SendDone(
+        ExportedData& rExportedData,
+        const MPI_Aint Size,
+        const MPI_Aint Resize);
+
+    void SendBufferReady(ImportedData& rImportedData);
+};
+
+#endif // CO_SIM_IO_BUILD_MPI_COMMUNICATION
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_MPI_RMA_COMMUNICATION_INCLUDED
@@ -235,6 +235,8 @@ class MPIDataCommunicator: public DataCommunicator
 
     bool IsNullOnThisRank() const override;
 
+    bool IsThreadSafe() const override;
+
     ///@}
     ///@name Helper functions for error checking in MPI
     ///@{
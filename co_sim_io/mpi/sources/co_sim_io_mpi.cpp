@@ -43,4 +43,10 @@ Info ConnectMPI(
         Internals::MPICommunicationFactory());
 }
 
+MPI_Comm GetMergedMPICommunicator(const Info& I_Info)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return Internals::MPIDataCommunicator::GetMPICommunicator(*Internals::GetConnection(connection_name).GetMergedDataCommunicator());
+}
+
 } // namespace CoSimIO
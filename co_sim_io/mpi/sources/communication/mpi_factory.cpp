@@ -16,6 +16,7 @@
 #include "mpi/includes/communication/mpi_factory.hpp"
 
 #include "mpi/includes/communication/mpi_inter_communication.hpp"
+#include "mpi/includes/communication/mpi_rma_communication.hpp"
 
 namespace CoSimIO {
 namespace Internals {
@@ -31,6 +32,11 @@ CommunicationFactory::CommCreateFctsType MPICommunicationFactory::GetCommunicati
         const Info& I_Settings,
         const std::shared_ptr<DataCommunicator> pDataComm){
             return CoSimIO::make_unique<MPIInterCommunication>(I_Settings, pDataComm);};
+
+    fcts["mpi_rma"] = [](
+        const Info& I_Settings,
+        const std::shared_ptr<DataCommunicator> pDataComm){
+            return CoSimIO::make_unique<MPIRMACommunication>(I_Settings, pDataComm);};
 #else
     fcts["mpi_inter"] = [](
         const Info& I_Settings,
@@ -38,6 +44,8 @@ CommunicationFactory::CommCreateFctsType MPICommunicationFactory::GetCommunicati
             CO_SIM_IO_ERROR << "Communication via MPI must be enabled at compile time with \"CO_SIM_IO_BUILD_MPI_COMMUNICATION\"!" << std::endl;
             return nullptr;};
 
+    fcts["mpi_rma"] = fcts["mpi_inter"];
+
 #endif // CO_SIM_IO_BUILD_MPI_COMMUNICATION
 
     return fcts;
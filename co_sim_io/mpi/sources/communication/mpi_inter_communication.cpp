@@ -11,6 +11,7 @@
 //
 
 // System includes
+#include <algorithm>
 
 // Project includes
 #include "mpi/includes/communication/mpi_inter_communication.hpp"
@@ -27,21 +28,32 @@ template<typename TMPIDataType>
 int ReceiveSize(
     MPI_Comm Comm,
     TMPIDataType DataType,
-    const int Rank)
+    const int Rank,
+    const int Tag)
 {
     int size;
     MPI_Status status;
-    MPI_Probe(Rank, 0, Comm, &status);
+    MPI_Probe(Rank, Tag, Comm, &status);
     MPI_Get_count(&status, DataType, &size);
     return size;
 }
 
+// tag 0 is used for all messages that are not exchanged with persistent requests
+int GetPersistentRequestTag(const std::size_t NumIdentifiers)
+{
+    // 32767 is the smallest upper bound for tags that is guaranteed by MPI
+    CO_SIM_IO_ERROR_IF(NumIdentifiers >= 32767) << "Too many identifiers are exchanged with persistent requests!" << std::endl;
+    return static_cast<int>(NumIdentifiers) + 1;
+}
+
 }
 
 MPIInterCommunication::MPIInterCommunication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
-    : Communication(I_Settings, I_DataComm)
+    : Communication(I_Settings, I_DataComm),
+      mUsePersistentRequests(I_Settings.Get<bool>("use_persistent_requests", false)),
+      mMergeCommunicators(I_Settings.Get<bool>("merge_communicators", false))
 {
     CO_SIM_IO_ERROR_IF_NOT(I_DataComm->IsDistributed()) << "MPI communication only works with a MPIDataCommunicator!" << std::endl;
 }
@@ -73,6 +85,13 @@ Info MPIInterCommunication::ConnectDetail(const Info& I_Info)
         MPI_Comm_connect(mPortName.c_str(), MPI_INFO_NULL, 0, my_comm, &mInterComm); // todo check return code
     }
 
+    if (GetMergeCommunicators()) {
+        MPI_Intercomm_merge(mInterComm, GetIsPrimaryConnection() ? 0 : 1, &mMergedComm); // todo check return code
+        // the user gets a duplicate, such that its messages cannot interfere with the ones of the CoSimIO
+        MPI_Comm_dup(mMergedComm, &mUserMergedComm); // todo check return code
+        mpMergedDataComm = std::make_shared<MPIDataCommunicator>(mUserMergedComm);
+    }
+
     return Info(); // TODO use
 
     CO_SIM_IO_CATCH
@@ -82,6 +101,14 @@ Info MPIInterCommunication::DisconnectDetail(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    FreePersistentRequests();
+
+    if (mMergedComm != MPI_COMM_NULL) {
+        mpMergedDataComm.reset();
+        MPI_Comm_free(&mUserMergedComm); // todo check return code
+        MPI_Comm_free(&mMergedComm); // todo check return code
+    }
+
     MPI_Comm_disconnect(&mInterComm); // todo check return code
 
     if (GetIsPrimaryConnection() && GetDataCommunicator().Rank()==0) {
@@ -92,6 +119,7 @@ Info MPIInterCommunication::DisconnectDetail(const Info& I_Info)
 
     CO_SIM_IO_CATCH
 }
+
 void MPIInterCommunication::PrepareConnection(const Info& I_Info)
 {
     CO_SIM_IO_TRY
@@ -122,11 +150,41 @@ Info MPIInterCommunication::GetCommunicationSettings() const
         info.Set("port_name", mPortName);
     }
 
+    info.Set<bool>("use_persistent_requests", mUsePersistentRequests);
+    info.Set<bool>("merge_communicators", GetMergeCommunicators());
+
     return info;
 
     CO_SIM_IO_CATCH
 }
 
+void MPIInterCommunication::DerivedHandShake() const
+{
+    CO_SIM_IO_TRY
+
+    const bool my_use_persistent_requests = GetMyInfo().Get<Info>("communication_settings").Get<bool>("use_persistent_requests");
+    const bool partner_use_persistent_requests = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_persistent_requests");
+    CO_SIM_IO_ERROR_IF(my_use_persistent_requests != partner_use_persistent_requests) << std::boolalpha << "Mismatch in use_persistent_requests!\nMy use_persistent_requests: " << my_use_persistent_requests << "\nPartner use_persistent_requests: " << partner_use_persistent_requests << std::noboolalpha << std::endl;
+
+    // merging is collective over the ranks of both partners
+    const bool my_merge_communicators = GetMyInfo().Get<Info>("communication_settings").Get<bool>("merge_communicators");
+    const bool partner_merge_communicators = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("merge_communicators");
+    CO_SIM_IO_ERROR_IF(my_merge_communicators != partner_merge_communicators) << std::boolalpha << "Mismatch in merge_communicators!\nMy merge_communicators: " << my_merge_communicators << "\nPartner merge_communicators: " << partner_merge_communicators << std::noboolalpha << std::endl;
+
+    CO_SIM_IO_CATCH
+}
+
+std::shared_ptr<DataCommunicator> MPIInterCommunication::GetMergedDataCommunicator() const
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF_NOT(mpMergedDataComm) << "The communicators are not merged, this has to be enabled with \"merge_communicators\"!" << std::endl;
+
+    return mpMergedDataComm;
+
+    CO_SIM_IO_CATCH
+}
+
 double MPIInterCommunication::SendString(
     const Info& I_Info,
     const std::string& rData)
@@ -154,7 +212,7 @@ double MPIInterCommunication::ReceiveString(
 {
     CO_SIM_IO_TRY
 
-    const int size = ReceiveSize(mInterComm, MPI_CHAR, GetDataCommunicator().Rank()); // serves also as synchronization for time measurement
+    const int size = ReceiveSize(mInterComm, MPI_CHAR, GetDataCommunicator().Rank(), 0); // serves also as synchronization for time measurement
     rData.resize(size);
 
     const auto start_time(std::chrono::steady_clock::now());
@@ -179,28 +237,224 @@ double MPIInterCommunication::SendDataContainer(
 {
     CO_SIM_IO_TRY
 
+    PostedSend posted_send = PostSendDataContainer(I_Info, rData, mUsePersistentRequests);
+    WaitForPostedSend(posted_send);
+
+    return Utilities::ElapsedSeconds(posted_send.StartTime);
+
+    CO_SIM_IO_CATCH
+}
+
+double MPIInterCommunication::ReceiveDataContainer(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    if (mUsePersistentRequests) {
+        return ReceiveDataContainerPersistent(I_Info, rData);
+    }
+
+    const int size = ReceiveSize(mInterComm, MPI_DOUBLE, GetDataCommunicator().Rank(), 0); // serves also as synchronization for time measurement
+    rData.resize(size);
+
     const auto start_time(std::chrono::steady_clock::now());
 
-    MPI_Send(
+    MPI_Recv(
         rData.data(),
         rData.size(),
         MPI_DOUBLE,
         GetDataCommunicator().Rank(),
         0,
-        mInterComm); // todo check return code
+        mInterComm,
+        MPI_STATUS_IGNORE); // todo check return code
 
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
 }
 
-double MPIInterCommunication::ReceiveDataContainer(
+std::future<Info> MPIInterCommunication::ExportDataAsyncImpl(
+    const Info& I_Info,
+    std::shared_ptr<const Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    // the data is only sent directly (with SendDataContainer) if it is neither serialized nor compressed,
+    // and not redistributed among the ranks
+    if (GetAlwaysUseSerializer() || GetCompression() != Compression::CompressionType::None || GetPartnerSize() != GetDataCommunicator().Size()) {
+        return Communication::ExportDataAsyncImpl(I_Info, pData);
+    }
+
+    // the send is posted from this thread, while the asynchronous thread might be in MPI at the same time
+    // this requires MPI_THREAD_MULTIPLE, which is checked already in "ExportDataAsync"
+    // the posted send is owned by the asynchronous operation, which only waits for its completion
+    auto p_posted_send = std::make_shared<PostedSend>(PostSendDataContainer(I_Info, *pData, false));
+
+    return EnqueueExportDataAsync(I_Info, [this, p_posted_send, pData](){
+        const Tracer::Scope trace_scope(GetTracer(), "ipc", "phase");
+        WaitForPostedSend(*p_posted_send);
+
+        Info info;
+        info.Set<double>("elapsed_time", Utilities::ElapsedSeconds(p_posted_send->StartTime));
+        info.Set<std::size_t>("memory_usage_ipc", pData->size()*sizeof(double));
+        return info;
+    });
+
+    CO_SIM_IO_CATCH
+}
+
+MPIInterCommunication::PostedSend MPIInterCommunication::PostSendDataContainer(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData,
+    const bool UsePersistentRequest)
+{
+    CO_SIM_IO_TRY
+
+    const int rank = GetDataCommunicator().Rank();
+
+    PostedSend posted_send;
+    posted_send.StartTime = std::chrono::steady_clock::now();
+
+    if (!mUsePersistentRequests) {
+        posted_send.Requests.resize(1);
+        MPI_Isend(
+            rData.data(),
+            rData.size(),
+            MPI_DOUBLE,
+            rank,
+            0,
+            mInterComm,
+            &posted_send.Requests[0]); // todo check return code
+
+        return posted_send;
+    }
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    auto it_send = mPersistentSends.find(identifier);
+    if (it_send == mPersistentSends.end()) {
+        PersistentSend new_send;
+        new_send.Tag = GetPersistentRequestTag(mPersistentSends.size());
+        it_send = mPersistentSends.emplace(identifier, new_send).first;
+    }
+    PersistentSend& r_send = it_send->second;
+
+    if (r_send.Size > 0 && r_send.Size == rData.size()) {
+        // the partner has pre-posted a receive of this size
+        if (!UsePersistentRequest) {
+            posted_send.Requests.resize(1);
+            MPI_Isend(
+                rData.data(),
+                rData.size(),
+                MPI_DOUBLE,
+                rank,
+                r_send.Tag,
+                mInterComm,
+                &posted_send.Requests[0]); // todo check return code
+
+            return posted_send;
+        }
+
+        if (r_send.pData != rData.data()) {
+            if (r_send.Request != MPI_REQUEST_NULL) {
+                MPI_Request_free(&r_send.Request); // todo check return code
+            }
+            MPI_Send_init(
+                rData.data(),
+                rData.size(),
+                MPI_DOUBLE,
+                rank,
+                r_send.Tag,
+                mInterComm,
+                &r_send.Request); // todo check return code
+            r_send.pData = rData.data();
+        }
+
+        MPI_Start(&r_send.Request); // todo check return code
+        posted_send.Requests.push_back(r_send.Request); // waiting does not free the persistent request
+
+        return posted_send;
+    }
+
+    // the size changed (or this is the first exchange), hence the data is sent as regular message
+    if (r_send.Request != MPI_REQUEST_NULL) {
+        MPI_Request_free(&r_send.Request); // todo check return code
+    }
+    r_send.pData = nullptr;
+
+    posted_send.Requests.resize(2, MPI_REQUEST_NULL);
+
+    if (r_send.Size > 0) {
+        // completing the pre-posted receive of the partner with an empty message, which notifies it of the change
+        MPI_Isend(nullptr, 0, MPI_DOUBLE, rank, r_send.Tag, mInterComm, &posted_send.Requests[0]); // todo check return code
+    }
+
+    MPI_Isend(
+        rData.data(),
+        rData.size(),
+        MPI_DOUBLE,
+        rank,
+        r_send.Tag,
+        mInterComm,
+        &posted_send.Requests[1]); // todo check return code
+
+    r_send.Size = rData.size(); // the partner pre-posts a receive of this size (if it is not empty)
+
+    return posted_send;
+
+    CO_SIM_IO_CATCH
+}
+
+void MPIInterCommunication::WaitForPostedSend(PostedSend& rPostedSend)
+{
+    CO_SIM_IO_TRY
+
+    MPI_Waitall(static_cast<int>(rPostedSend.Requests.size()), rPostedSend.Requests.data(), MPI_STATUSES_IGNORE); // todo check return code
+    rPostedSend.Requests.clear();
+
+    CO_SIM_IO_CATCH
+}
+
+double MPIInterCommunication::ReceiveDataContainerPersistent(
     const Info& I_Info,
     Internals::DataContainer<double>& rData)
 {
     CO_SIM_IO_TRY
 
-    const int size = ReceiveSize(mInterComm, MPI_DOUBLE, GetDataCommunicator().Rank()); // serves also as synchronization for time measurement
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+    const int rank = GetDataCommunicator().Rank();
+
+    auto it_receive = mPersistentReceives.find(identifier);
+    if (it_receive == mPersistentReceives.end()) {
+        PersistentReceive new_receive;
+        new_receive.Tag = GetPersistentRequestTag(mPersistentReceives.size());
+        it_receive = mPersistentReceives.emplace(identifier, new_receive).first;
+    }
+    PersistentReceive& r_receive = it_receive->second;
+
+    if (r_receive.Request != MPI_REQUEST_NULL) {
+        MPI_Status status;
+        MPI_Wait(&r_receive.Request, &status); // serves also as synchronization for time measurement
+        int size;
+        MPI_Get_count(&status, MPI_DOUBLE, &size);
+
+        if (size > 0) {
+            const auto start_time(std::chrono::steady_clock::now());
+
+            rData.resize(size);
+            std::copy(r_receive.Buffer.begin(), r_receive.Buffer.end(), rData.data());
+
+            MPI_Start(&r_receive.Request); // pre-posting the receive for the next import, todo check return code
+
+            return Utilities::ElapsedSeconds(start_time);
+        }
+
+        // an empty message means that the size changed, the data follows as regular message
+        MPI_Request_free(&r_receive.Request); // todo check return code
+    }
+
+    const int size = ReceiveSize(mInterComm, MPI_DOUBLE, rank, r_receive.Tag); // serves also as synchronization for time measurement
     rData.resize(size);
 
     const auto start_time(std::chrono::steady_clock::now());
@@ -209,16 +463,55 @@ double MPIInterCommunication::ReceiveDataContainer(
         rData.data(),
         rData.size(),
         MPI_DOUBLE,
-        GetDataCommunicator().Rank(),
-        0,
+        rank,
+        r_receive.Tag,
         mInterComm,
         MPI_STATUS_IGNORE); // todo check return code
 
+    if (size > 0) {
+        // pre-posting the receive for the next import, assuming that the size stays the same
+        r_receive.Buffer.resize(size);
+        MPI_Recv_init(
+            r_receive.Buffer.data(),
+            size,
+            MPI_DOUBLE,
+            rank,
+            r_receive.Tag,
+            mInterComm,
+            &r_receive.Request); // todo check return code
+        MPI_Start(&r_receive.Request); // todo check return code
+    }
+
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
 }
 
+void MPIInterCommunication::FreePersistentRequests()
+{
+    CO_SIM_IO_TRY
+
+    for (auto& r_send : mPersistentSends) {
+        if (r_send.second.Request != MPI_REQUEST_NULL) {
+            MPI_Request_free(&r_send.second.Request); // todo check return code
+        }
+    }
+
+    for (auto& r_receive : mPersistentReceives) {
+        if (r_receive.second.Request != MPI_REQUEST_NULL) {
+            // the pre-posted receives are still active
+            MPI_Cancel(&r_receive.second.Request); // todo check return code
+            MPI_Wait(&r_receive.second.Request, MPI_STATUS_IGNORE); // todo check return code
+            MPI_Request_free(&r_receive.second.Request); // todo check return code
+        }
+    }
+
+    mPersistentSends.clear();
+    mPersistentReceives.clear();
+
+    CO_SIM_IO_CATCH
+}
+
 #endif // CO_SIM_IO_BUILD_MPI_COMMUNICATION
 
 } // namespace Internals
@@ -0,0 +1,255 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <algorithm>
+
+// Project includes
+#include "mpi/includes/communication/mpi_rma_communication.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+#ifdef CO_SIM_IO_BUILD_MPI_COMMUNICATION
+
+namespace {
+
+// Protocol for exchanging the data of one identifier:
+// - the importer sends "ready" (address and capacity of its buffer) as soon as the buffer can be written,
+//   i.e. before the first import and after copying the data out of the buffer
+// - the exporter waits for "ready" and puts the data into the buffer, then it sends "done" (size of the data)
+// - if the buffer is too small, the exporter sends "done" with the request to resize the buffer first,
+//   the importer then resizes the buffer and sends "ready" again
+// tag 0 is used by the MPIInterCommunication, "done" uses odd and "ready" uses even tags
+int GetDoneTag(const std::size_t Index)
+{
+    // 32767 is the smallest upper bound for tags that is guaranteed by MPI
+    CO_SIM_IO_ERROR_IF(Index >= 16383) << "Too many identifiers are exchanged!" << std::endl;
+    return 2*static_cast<int>(Index) + 1;
+}
+
+int GetReadyTag(const int DoneTag)
+{
+    return DoneTag + 1;
+}
+
+}
+
+MPIRMACommunication::~MPIRMACommunication()
+{
+    if (GetIsConnected()) {
+        CO_SIM_IO_INFO("CoSimIO") << "Warning: Disconnect was not performed, attempting automatic disconnection!" << std::endl;
+        Info tmp;
+        Disconnect(tmp);
+    }
+}
+
+Info MPIRMACommunication::ConnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    Info info = BaseType::ConnectDetail(I_Info);
+
+    MPI_Comm_rank(GetMergedCommunicator(), &mMyRank);
+
+    const int rank = GetDataCommunicator().Rank();
+    mPartnerRank = GetIsPrimaryConnection() ? GetDataCommunicator().Size()+rank : rank;
+
+    // the buffers are attached when they are first used, as creating a window is collective
+    MPI_Win_create_dynamic(MPI_INFO_NULL, GetMergedCommunicator(), &mWindow); // todo check return code
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info MPIRMACommunication::DisconnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    // receiving the "ready" that the partner sent after its last import, otherwise it would remain unmatched
+    for (const auto& r_exported_data : mExportedData) {
+        MPI_Aint ready[2];
+        MPI_Recv(ready, 2, MPI_AINT, mPartnerRank, GetReadyTag(r_exported_data.second.Tag), GetMergedCommunicator(), MPI_STATUS_IGNORE); // todo check return code
+    }
+
+    // completing the last synchronization messages, the partner receives them before it disconnects
+    for (auto& r_exported_data : mExportedData) {
+        MPI_Wait(&r_exported_data.second.DoneRequest, MPI_STATUS_IGNORE); // todo check return code
+    }
+
+    for (auto& r_imported_data : mImportedData) {
+        MPI_Wait(&r_imported_data.second.ReadyRequest, MPI_STATUS_IGNORE); // todo check return code
+        if (!r_imported_data.second.Buffer.empty()) {
+            MPI_Win_detach(mWindow, r_imported_data.second.Buffer.data()); // todo check return code
+        }
+    }
+
+    mExportedData.clear();
+    mImportedData.clear();
+
+    MPI_Win_free(&mWindow); // todo check return code
+
+    return BaseType::DisconnectDetail(I_Info);
+
+    CO_SIM_IO_CATCH
+}
+
+double MPIRMACommunication::SendDataContainer(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    auto it_exported_data = mExportedData.find(identifier);
+    if (it_exported_data == mExportedData.end()) {
+        ExportedData new_exported_data;
+        new_exported_data.Tag = GetDoneTag(mExportedData.size());
+        it_exported_data = mExportedData.emplace(identifier, new_exported_data).first;
+    }
+    ExportedData& r_exported_data = it_exported_data->second;
+    const int ready_tag = GetReadyTag(r_exported_data.Tag);
+
+    MPI_Aint ready[2]; // address and capacity of the buffer of the partner
+    MPI_Recv(ready, 2, MPI_AINT, mPartnerRank, ready_tag, GetMergedCommunicator(), MPI_STATUS_IGNORE); // serves also as synchronization for time measurement, todo check return code
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    const MPI_Aint size = static_cast<MPI_Aint>(rData.size());
+
+    if (size > ready[1]) {
+        SendDone(r_exported_data, size, 1);
+        MPI_Recv(ready, 2, MPI_AINT, mPartnerRank, ready_tag, GetMergedCommunicator(), MPI_STATUS_IGNORE); // todo check return code
+    }
+
+    if (size > 0) {
+        MPI_Win_lock(MPI_LOCK_SHARED, mPartnerRank, 0, mWindow); // todo check return code
+        MPI_Put(
+            rData.data(),
+            static_cast<int>(size),
+            MPI_DOUBLE,
+            mPartnerRank,
+            ready[0], // windows with dynamically attached memory use the address as displacement
+            static_cast<int>(size),
+            MPI_DOUBLE,
+            mWindow); // todo check return code
+        MPI_Win_unlock(mPartnerRank, mWindow); // completes the put also at the target, todo check return code
+    }
+
+    SendDone(r_exported_data, size, 0);
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+double MPIRMACommunication::ReceiveDataContainer(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    auto it_imported_data = mImportedData.find(identifier);
+    if (it_imported_data == mImportedData.end()) {
+        ImportedData new_imported_data;
+        new_imported_data.Tag = GetDoneTag(mImportedData.size());
+        it_imported_data = mImportedData.emplace(identifier, new_imported_data).first;
+        SendBufferReady(it_imported_data->second);
+    }
+    ImportedData& r_imported_data = it_imported_data->second;
+
+    MPI_Aint done[2]; // size of the data and whether the buffer has to be resized
+    MPI_Recv(done, 2, MPI_AINT, mPartnerRank, r_imported_data.Tag, GetMergedCommunicator(), MPI_STATUS_IGNORE); // serves also as synchronization for time measurement, todo check return code
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    if (done[1] == 1) {
+        if (!r_imported_data.Buffer.empty()) {
+            MPI_Win_detach(mWindow, r_imported_data.Buffer.data()); // todo check return code
+        }
+        r_imported_data.Buffer.resize(done[0]);
+        r_imported_data.Buffer.shrink_to_fit();
+        MPI_Win_attach(mWindow, r_imported_data.Buffer.data(), r_imported_data.Buffer.size()*sizeof(double)); // todo check return code
+
+        SendBufferReady(r_imported_data);
+        MPI_Recv(done, 2, MPI_AINT, mPartnerRank, r_imported_data.Tag, GetMergedCommunicator(), MPI_STATUS_IGNORE); // todo check return code
+    }
+
+    // synchronizing the public and the private copy of the window
+    MPI_Win_lock(MPI_LOCK_SHARED, mMyRank, 0, mWindow); // todo check return code
+    MPI_Win_unlock(mMyRank, mWindow); // todo check return code
+
+    rData.resize(done[0]);
+    std::copy(r_imported_data.Buffer.begin(), r_imported_data.Buffer.begin()+done[0], rData.data());
+
+    SendBufferReady(r_imported_data); // the buffer can be written again
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+std::future<Info> MPIRMACommunication::ExportDataAsyncImpl(
+    const Info& I_Info,
+    std::shared_ptr<const Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    return Communication::ExportDataAsyncImpl(I_Info, pData);
+
+    CO_SIM_IO_CATCH
+}
+
+void MPIRMACommunication::SendDone(
+    ExportedData& rExportedData,
+    const MPI_Aint Size,
+    const MPI_Aint Resize)
+{
+    CO_SIM_IO_TRY
+
+    // the previous message was already received by the partner, as it answered with "ready"
+    MPI_Wait(&rExportedData.DoneRequest, MPI_STATUS_IGNORE); // todo check return code
+
+    rExportedData.Done[0] = Size;
+    rExportedData.Done[1] = Resize;
+
+    MPI_Isend(rExportedData.Done, 2, MPI_AINT, mPartnerRank, rExportedData.Tag, GetMergedCommunicator(), &rExportedData.DoneRequest); // todo check return code
+
+    CO_SIM_IO_CATCH
+}
+
+void MPIRMACommunication::SendBufferReady(ImportedData& rImportedData)
+{
+    CO_SIM_IO_TRY
+
+    // the previous message was already received by the partner, as it answered with "done"
+    MPI_Wait(&rImportedData.ReadyRequest, MPI_STATUS_IGNORE); // todo check return code
+
+    rImportedData.Ready[0] = 0;
+    rImportedData.Ready[1] = static_cast<MPI_Aint>(rImportedData.Buffer.size());
+    if (!rImportedData.Buffer.empty()) {
+        MPI_Get_address(rImportedData.Buffer.data(), &rImportedData.Ready[0]); // todo check return code
+    }
+
+    MPI_Isend(rImportedData.Ready, 2, MPI_AINT, mPartnerRank, GetReadyTag(rImportedData.Tag), GetMergedCommunicator(), &rImportedData.ReadyRequest); // todo check return code
+
+    CO_SIM_IO_CATCH
+}
+
+#endif // CO_SIM_IO_BUILD_MPI_COMMUNICATION
+
+} // namespace Internals
+} // namespace CoSimIO
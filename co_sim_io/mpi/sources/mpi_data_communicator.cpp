@@ -336,6 +336,14 @@ bool MPIDataCommunicator::IsNullOnThisRank() const
     return mComm == MPI_COMM_NULL;
 }
 
+bool MPIDataCommunicator::IsThreadSafe() const
+{
+    int provided;
+    int ierr = MPI_Query_thread(&provided);
+    CheckMPIErrorCode(ierr, "MPI_Query_thread");
+    return provided == MPI_THREAD_MULTIPLE;
+}
+
 // IO
 
 std::string MPIDataCommunicator::Info() const
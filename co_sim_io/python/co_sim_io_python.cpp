@@ -37,6 +37,55 @@ PYBIND11_DECLARE_HOLDER_TYPE(T, CoSimIO::intrusive_ptr<T>)
 #include "connection_status_to_python.hpp"
 #include "version_to_python.hpp"
 
+namespace { // anonymous namespace
+
+// using the memory of buffers (e.g. numpy arrays) directly, without copying
+// the GIL is released only after the buffer was requested, as this requires the GIL
+template<typename TDataType>
+CoSimIO::Info ImportDataIntoBuffer(const CoSimIO::Info& I_Info, pybind11::buffer_info& rInfo)
+{
+    CoSimIO::DataContainerPythonBuffer<TDataType> data_container(rInfo);
+    pybind11::gil_scoped_release release;
+    return CoSimIO::ImportData(
+    I_Info,
+    static_cast<CoSimIO::Internals::DataContainer<TDataType>&>(data_container));
+}
+
+template<typename TDataType>
+CoSimIO::Info ExportDataFromBuffer(const CoSimIO::Info& I_Info, pybind11::buffer_info& rInfo)
+{
+    const CoSimIO::DataContainerPythonBuffer<TDataType> data_container(rInfo);
+    pybind11::gil_scoped_release release;
+    return CoSimIO::ExportData(
+    I_Info,
+    static_cast<const CoSimIO::Internals::DataContainer<TDataType>&>(data_container));
+}
+
+// the type of the data is determined by the format of the buffer
+CoSimIO::Info ImportDataIntoBuffer(const CoSimIO::Info& I_Info, pybind11::buffer_info& rInfo)
+{
+    if (rInfo.item_type_is_equivalent_to<double>())               return ImportDataIntoBuffer<double>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<float>())                return ImportDataIntoBuffer<float>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<std::int32_t>())         return ImportDataIntoBuffer<std::int32_t>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<std::int64_t>())         return ImportDataIntoBuffer<std::int64_t>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<std::complex<double>>()) return ImportDataIntoBuffer<std::complex<double>>(I_Info, rInfo);
+    CO_SIM_IO_ERROR << "Buffer has unsupported data type, got format \"" << rInfo.format << "\"!" << std::endl;
+    return CoSimIO::Info();
+}
+
+CoSimIO::Info ExportDataFromBuffer(const CoSimIO::Info& I_Info, pybind11::buffer_info& rInfo)
+{
+    if (rInfo.item_type_is_equivalent_to<double>())               return ExportDataFromBuffer<double>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<float>())                return ExportDataFromBuffer<float>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<std::int32_t>())         return ExportDataFromBuffer<std::int32_t>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<std::int64_t>())         return ExportDataFromBuffer<std::int64_t>(I_Info, rInfo);
+    if (rInfo.item_type_is_equivalent_to<std::complex<double>>()) return ExportDataFromBuffer<std::complex<double>>(I_Info, rInfo);
+    CO_SIM_IO_ERROR << "Buffer has unsupported data type, got format \"" << rInfo.format << "\"!" << std::endl;
+    return CoSimIO::Info();
+}
+
+} // anonymous namespace
+
 
 PYBIND11_MODULE(PyCoSimIO, m)
 {
@@ -44,28 +93,62 @@ PYBIND11_MODULE(PyCoSimIO, m)
 
     m.def("Hello", & CoSimIO::Hello);
 
-    m.def("Connect",    &CoSimIO::Connect);
-    m.def("Disconnect", &CoSimIO::Disconnect);
+    // the blocking functions release the GIL, such that several connections can be used from different Python threads
+    // Note: one connection must not be used from several threads at the same time
+    using release_gil = py::call_guard<py::gil_scoped_release>;
 
-    m.def("ImportMesh", &CoSimIO::ImportMesh);
-    m.def("ExportMesh", &CoSimIO::ExportMesh);
+    m.def("Connect",    &CoSimIO::Connect,    release_gil());
+    m.def("Disconnect", &CoSimIO::Disconnect, release_gil());
+
+    m.def("ImportMesh", &CoSimIO::ImportMesh, release_gil());
+    m.def("ExportMesh", &CoSimIO::ExportMesh, release_gil());
 
     m.def("ImportData", [](const CoSimIO::Info& I_Info, CoSimIO::VectorWrapper<double>& rValues){
         return CoSimIO::ImportData(
         I_Info,
         rValues.Vector());
-    });
+    }, release_gil());
     m.def("ExportData", [](const CoSimIO::Info& I_Info, const CoSimIO::VectorWrapper<double>& rValues){
         return CoSimIO::ExportData(
         I_Info,
         rValues.Vector());
+    }, release_gil());
+
+    // using the memory of buffers (e.g. numpy arrays) directly, without copying
+    // besides float64, also buffers of float32, int32, int64 and complex128 are supported
+    m.def("ImportData", [](const CoSimIO::Info& I_Info, py::buffer Values){
+        py::buffer_info info = Values.request(true); // must be writable
+        return ImportDataIntoBuffer(I_Info, info);
+    });
+    m.def("ExportData", [](const CoSimIO::Info& I_Info, py::buffer Values){
+        py::buffer_info info = Values.request();
+        return ExportDataFromBuffer(I_Info, info);
     });
 
-    m.def("ImportInfo", &CoSimIO::ImportInfo);
-    m.def("ExportInfo", &CoSimIO::ExportInfo);
+    // the containers are passed as list of (identifier, DoubleVector) tuples
+    m.def("ImportDataBatch", [](const CoSimIO::Info& I_Info, const std::vector<std::pair<std::string, CoSimIO::VectorWrapper<double>*>>& rValues){
+        std::vector<std::pair<std::string, std::vector<double>*>> data;
+        for (const auto& r_values : rValues) {
+            data.emplace_back(r_values.first, &r_values.second->Vector());
+        }
+        return CoSimIO::ImportDataBatch(I_Info, data);
+    }, release_gil());
+    m.def("ExportDataBatch", [](const CoSimIO::Info& I_Info, const std::vector<std::pair<std::string, const CoSimIO::VectorWrapper<double>*>>& rValues){
+        std::vector<std::pair<std::string, const std::vector<double>*>> data;
+        for (const auto& r_values : rValues) {
+            data.emplace_back(r_values.first, &r_values.second->Vector());
+        }
+        return CoSimIO::ExportDataBatch(I_Info, data);
+    }, release_gil());
+
+    m.def("ImportInfo", &CoSimIO::ImportInfo, release_gil());
+    m.def("ExportInfo", &CoSimIO::ExportInfo, release_gil());
+
+    m.def("GetStatistics", &CoSimIO::GetStatistics);
 
     // functions for CoSim-orchestrated CoSimulation
-    m.def("Run", &CoSimIO::Run);
+    // the registered Python functions acquire the GIL when they are called
+    m.def("Run", &CoSimIO::Run, release_gil());
 
     m.def("Register", [](
         const CoSimIO::Info& I_Info,
@@ -25,12 +25,14 @@ PYBIND11_MODULE(PyCoSimIOMPI, m)
     namespace py = pybind11;
 
     m.def("ConnectMPI", [](const CoSimIO::Info& I_Info)
-        { return CoSimIO::ConnectMPI(I_Info, MPI_COMM_WORLD); });
+        { return CoSimIO::ConnectMPI(I_Info, MPI_COMM_WORLD); },
+        py::call_guard<py::gil_scoped_release>());
 
     m.def("ConnectMPI", [](const CoSimIO::Info& I_Info, const CoSimIO::MPICommHolder& holder)
         {
             return CoSimIO::ConnectMPI(I_Info, holder.GetMPIComm());
-        });
+        },
+        py::call_guard<py::gil_scoped_release>());
 
     py::class_<CoSimIO::MPICommHolder, std::shared_ptr<CoSimIO::MPICommHolder>>(m,"MPICommHolder");
 }
@@ -40,6 +40,8 @@ void AddCoSimIOModelPartToPython(pybind11::module& m)
         .def("Y",  &CoSimIO::Node::Y)
         .def("Z",  &CoSimIO::Node::Z)
         .def("Coordinates",  &CoSimIO::Node::Coordinates)
+        .def("SetCoordinates", static_cast<void (CoSimIO::Node::*)(const double, const double, const double)>(&CoSimIO::Node::SetCoordinates))
+        .def("SetCoordinates", static_cast<void (CoSimIO::Node::*)(const CoSimIO::CoordinatesType&)>(&CoSimIO::Node::SetCoordinates))
         .def("__str__",   [](const CoSimIO::Node& I_Node)
             { std::stringstream ss; ss << I_Node; return ss.str(); } )
         ;
@@ -16,15 +16,18 @@
 // Exposure of the CoSimIO to Python
 
 // System includes
+#include <algorithm>
 #include <vector>
 #include <sstream>
 
 // pybind includes
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/complex.h>
 
 //
 #include "includes/define.hpp"
+#include "includes/data_container.hpp"
 
 namespace CoSimIO {
 
@@ -50,6 +53,50 @@ private:
     std::vector<TDataType> mVector;
 };
 
+// checks that a buffer can be used directly (without copying) as a 1D array of the given type
+template<typename TDataType>
+void CheckBufferInfo(const pybind11::buffer_info& rInfo)
+{
+    CO_SIM_IO_ERROR_IF(!rInfo.item_type_is_equivalent_to<TDataType>()) << "Buffer has wrong data type, got format \"" << rInfo.format << "\"!" << std::endl;
+    CO_SIM_IO_ERROR_IF(rInfo.ndim != 1) << "Buffer dimension of 1 is required, got: " << rInfo.ndim << std::endl;
+    CO_SIM_IO_ERROR_IF(rInfo.shape[0] > 1 && rInfo.strides[0] != static_cast<pybind11::ssize_t>(sizeof(TDataType))) << "Buffer must be contiguous!" << std::endl;
+}
+
+// DataContainer that directly uses the memory of a Python buffer (e.g. numpy array or memoryview) without copying
+// the memory is owned by Python, hence the size cannot be changed
+template<typename TDataType>
+class DataContainerPythonBuffer : public Internals::DataContainer<TDataType>
+{
+public:
+    explicit DataContainerPythonBuffer(pybind11::buffer_info& rInfo)
+        : mpData(static_cast<TDataType*>(rInfo.ptr)), mSize(GetCheckedSize(rInfo)), mReadOnly(rInfo.readonly)
+    { }
+
+    std::size_t size() const override {return mSize;}
+    void resize(const std::size_t NewSize) override
+    {
+        CO_SIM_IO_ERROR_IF(NewSize != mSize) << "The size of the buffer (" << mSize << ") does not match the size of the received data (" << NewSize << ") and a buffer cannot be resized!" << std::endl;
+    }
+    const TDataType* data() const override {return mpData;}
+    TDataType* data() override
+    {
+        CO_SIM_IO_ERROR_IF(mReadOnly) << "Buffer is readonly!" << std::endl;
+        return mpData;
+    }
+
+private:
+    TDataType* mpData;
+    const std::size_t mSize;
+    const bool mReadOnly;
+
+    // the buffer has to be checked before accessing its shape
+    static std::size_t GetCheckedSize(const pybind11::buffer_info& rInfo)
+    {
+        CheckBufferInfo<TDataType>(rInfo);
+        return static_cast<std::size_t>(rInfo.shape[0]);
+    }
+};
+
 } // namespace CoSimIO
 
 namespace { // anonymous namespace
@@ -63,7 +110,7 @@ void AddVectorWithTypeToPython(pybind11::module& m, const std::string& Name)
 
     const std::string full_name = Name+"Vector";
 
-    py::class_<VectorType>(m, full_name.c_str())
+    py::class_<VectorType>(m, full_name.c_str(), py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<const VectorType&>())
         .def(py::init( [](const py::list& l){
@@ -78,12 +125,30 @@ void AddVectorWithTypeToPython(pybind11::module& m, const std::string& Name)
             CO_SIM_IO_ERROR_IF(info.format != py::format_descriptor<TDataType>::value) << "Expected a " << Name << " array!";
             CO_SIM_IO_ERROR_IF(info.ndim != 1) << "Buffer dimension of 1 is required, got: " << info.ndim << std::endl;
             VectorType vec(info.shape[0]);
-            for (int i=0; i<info.shape[0]; ++i) {
-                vec.Vector()[i] = static_cast<TDataType *>(info.ptr)[i];
+            const char* p_data = static_cast<const char*>(info.ptr);
+            if (info.strides[0] == static_cast<py::ssize_t>(sizeof(TDataType))) { // contiguous, can be copied in one block
+                std::copy(reinterpret_cast<const TDataType*>(p_data), reinterpret_cast<const TDataType*>(p_data)+info.shape[0], vec.Vector().begin());
+            } else {
+                for (py::ssize_t i=0; i<info.shape[0]; ++i) {
+                    vec.Vector()[i] = *reinterpret_cast<const TDataType*>(p_data + i*info.strides[0]);
+                }
             }
             return vec;
         }))
 
+        // exposing the memory, this way e.g. numpy.asarray does not copy
+        // Note: resizing the vector invalidates the buffer!
+        .def_buffer([](VectorType& v) -> py::buffer_info {
+            return py::buffer_info(
+                v.Vector().data(),
+                sizeof(TDataType),
+                py::format_descriptor<TDataType>::format(),
+                1,
+                {static_cast<py::ssize_t>(v.Vector().size())},
+                {static_cast<py::ssize_t>(sizeof(TDataType))}
+            );
+        })
+
         .def("__len__", [](VectorType& v)
             { return v.Vector().size(); } )
         .def("size", [](VectorType& v)
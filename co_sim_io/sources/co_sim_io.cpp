@@ -109,6 +109,145 @@ Info CO_SIM_IO_API ExportData(
     return CoSimIO::Internals::GetConnection(connection_name).ExportData(I_Info, rData);
 }
 
+// Versions for other types than double, the type is checked by the receiver
+#define CO_SIM_IO_DEFINE_TYPED_DATA_EXCHANGE(TDataType)                                             \
+template<>                                                                                          \
+Info CO_SIM_IO_API ImportData(                                                                      \
+    const Info& I_Info,                                                                             \
+    std::vector<TDataType>& rData)                                                                  \
+{                                                                                                   \
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");                 \
+    Internals::DataContainerStdVector<TDataType> container(rData);                                  \
+    return Internals::GetConnection(connection_name).ImportData(I_Info, container);                 \
+}                                                                                                   \
+template<>                                                                                          \
+Info CO_SIM_IO_API ImportData(                                                                      \
+    const Info& I_Info,                                                                             \
+    Internals::DataContainer<TDataType>& rData)                                                     \
+{                                                                                                   \
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");                 \
+    return Internals::GetConnection(connection_name).ImportData(I_Info, rData);                     \
+}                                                                                                   \
+template<>                                                                                          \
+Info CO_SIM_IO_API ExportData(                                                                      \
+    const Info& I_Info,                                                                             \
+    const std::vector<TDataType>& rData)                                                            \
+{                                                                                                   \
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");                 \
+    const Internals::DataContainerStdVectorReadOnly<TDataType> container(rData);                    \
+    return Internals::GetConnection(connection_name).ExportData(I_Info, container);                 \
+}                                                                                                   \
+template<>                                                                                          \
+Info CO_SIM_IO_API ExportData(                                                                      \
+    const Info& I_Info,                                                                             \
+    const Internals::DataContainer<TDataType>& rData)                                               \
+{                                                                                                   \
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");                 \
+    return Internals::GetConnection(connection_name).ExportData(I_Info, rData);                     \
+}
+
+CO_SIM_IO_DEFINE_TYPED_DATA_EXCHANGE(float)
+CO_SIM_IO_DEFINE_TYPED_DATA_EXCHANGE(std::int32_t)
+CO_SIM_IO_DEFINE_TYPED_DATA_EXCHANGE(std::int64_t)
+CO_SIM_IO_DEFINE_TYPED_DATA_EXCHANGE(std::complex<double>)
+
+#undef CO_SIM_IO_DEFINE_TYPED_DATA_EXCHANGE
+
+// Version for C++, there the input are std::vectors, which we have to wrap before passing them on
+template<>
+Info CO_SIM_IO_API ImportDataBatch(
+    const Info& I_Info,
+    const std::vector<std::pair<std::string, std::vector<double>*>>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    std::vector<std::unique_ptr<DataContainer<double>>> containers;
+    Communication::DataBatchType data_batch;
+    for (const auto& r_data : rData) {
+        containers.emplace_back(new DataContainerStdVector<double>(*r_data.second));
+        data_batch.emplace_back(r_data.first, containers.back().get());
+    }
+    return GetConnection(connection_name).ImportDataBatch(I_Info, data_batch);
+}
+
+template<>
+Info CO_SIM_IO_API ImportDataBatch(
+    const Info& I_Info,
+    const std::vector<std::pair<std::string, CoSimIO::Internals::DataContainer<double>*>>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).ImportDataBatch(I_Info, rData);
+}
+
+template<>
+Info CO_SIM_IO_API ExportDataBatch(
+    const Info& I_Info,
+    const std::vector<std::pair<std::string, const std::vector<double>*>>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    std::vector<std::unique_ptr<DataContainer<double>>> containers;
+    Communication::ConstDataBatchType data_batch;
+    for (const auto& r_data : rData) {
+        containers.emplace_back(new DataContainerStdVectorReadOnly<double>(*r_data.second));
+        data_batch.emplace_back(r_data.first, containers.back().get());
+    }
+    return GetConnection(connection_name).ExportDataBatch(I_Info, data_batch);
+}
+
+template<>
+Info CO_SIM_IO_API ExportDataBatch(
+    const Info& I_Info,
+    const std::vector<std::pair<std::string, const CoSimIO::Internals::DataContainer<double>*>>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).ExportDataBatch(I_Info, rData);
+}
+
+template<>
+std::future<Info> CO_SIM_IO_API ImportDataAsync(
+    const Info& I_Info,
+    std::vector<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    std::shared_ptr<DataContainer<double>> p_container(std::make_shared<DataContainerStdVector<double>>(rData)); // kept alive until the operation is completed
+    return GetConnection(connection_name).ImportDataAsync(I_Info, p_container);
+}
+
+template<>
+std::future<Info> CO_SIM_IO_API ImportDataAsync(
+    const Info& I_Info,
+    CoSimIO::Internals::DataContainer<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    std::shared_ptr<DataContainer<double>> p_container(&rData, [](DataContainer<double>*){}); // not owning the container
+    return GetConnection(connection_name).ImportDataAsync(I_Info, p_container);
+}
+
+template<>
+std::future<Info> CO_SIM_IO_API ExportDataAsync(
+    const Info& I_Info,
+    const std::vector<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    std::shared_ptr<const DataContainer<double>> p_container(std::make_shared<DataContainerStdVectorReadOnly<double>>(rData)); // kept alive until the operation is completed
+    return GetConnection(connection_name).ExportDataAsync(I_Info, p_container);
+}
+
+template<>
+std::future<Info> CO_SIM_IO_API ExportDataAsync(
+    const Info& I_Info,
+    const CoSimIO::Internals::DataContainer<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    std::shared_ptr<const DataContainer<double>> p_container(&rData, [](const DataContainer<double>*){}); // not owning the container
+    return GetConnection(connection_name).ExportDataAsync(I_Info, p_container);
+}
+
 Info ImportMesh(
     const Info& I_Info,
     ModelPart& O_ModelPart)
@@ -139,6 +278,13 @@ Info ExportInfo(
     return CoSimIO::Internals::GetConnection(connection_name).ExportInfo(I_Info);
 }
 
+Info GetStatistics(
+    const Info& I_Info)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).GetStatistics();
+}
+
 Info Run(const Info& I_Info)
 {
     const std::string connection_name = I_Info.Get<std::string>("connection_name");
@@ -11,6 +11,9 @@
 //
 
 // System includes
+#include <algorithm>
+#include <exception>
+#include <future>
 
 // Project includes
 #include "includes/communication/base_socket_communication.hpp"
@@ -18,6 +21,35 @@
 namespace CoSimIO {
 namespace Internals {
 
+namespace {
+
+// messages are only striped if each stream transfers at least this many bytes
+// for smaller messages the overhead of handing the stripes to the stream workers outweighs the gain
+const std::size_t MIN_STRIPE_SIZE = 1 << 20; // 1 MB
+
+// returns the part [Begin, End) (in bytes) of the buffer sequence
+template<class TBufferType>
+std::vector<TBufferType> GetBufferRange(
+    const std::vector<TBufferType>& rBuffers,
+    const std::size_t Begin,
+    const std::size_t End)
+{
+    std::vector<TBufferType> buffer_range;
+    std::size_t buffer_begin = 0;
+    for (const auto& r_buffer : rBuffers) {
+        const std::size_t buffer_end = buffer_begin + r_buffer.size();
+        if (buffer_end > Begin && buffer_begin < End) {
+            const std::size_t local_begin = std::max(Begin, buffer_begin) - buffer_begin;
+            const std::size_t local_end = std::min(End, buffer_end) - buffer_begin;
+            buffer_range.push_back(asio::buffer(r_buffer + local_begin, local_end - local_begin));
+        }
+        buffer_begin = buffer_end;
+    }
+    return buffer_range;
+}
+
+} // anonymous namespace
+
 template<class TSocketType>
 BaseSocketCommunication<TSocketType>::~BaseSocketCommunication()
 {
@@ -29,6 +61,8 @@ BaseSocketCommunication<TSocketType>::~BaseSocketCommunication()
         Disconnect(tmp);
     }
 
+    StopStreamWorkers(); // in case connecting failed after the workers were started
+
     CO_SIM_IO_CATCH
 }
 
@@ -40,6 +74,8 @@ Info BaseSocketCommunication<TSocketType>::ConnectDetail(const Info& I_Info)
     // required such that asio keeps listening for incoming messages
     mContextThread = std::thread([this]() { mAsioContext.run(); });
 
+    StartStreamWorkers();
+
     return Info();
 
     CO_SIM_IO_CATCH
@@ -50,14 +86,24 @@ Info BaseSocketCommunication<TSocketType>::DisconnectDetail(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    StopStreamWorkers();
+
     // Request the context to close
     mAsioContext.stop();
 
     // Tidy up the context thread
     if (mContextThread.joinable()) mContextThread.join();
 
-    mpAsioSocket->close();
-    mpAsioSocket.reset(); // important to release the resouces (otherwise crashes in Win with release compilation)
+    if (mpAsioSocket) { // ranks without partner rank don't have a socket
+        mpAsioSocket->close();
+        mpAsioSocket.reset(); // important to release the resouces (otherwise crashes in Win with release compilation)
+    }
+
+    for (auto& rp_socket : mpAsioStreamSockets) {
+        rp_socket->close();
+        rp_socket.reset();
+    }
+    mpAsioStreamSockets.clear();
 
     return Info();
 
@@ -74,7 +120,7 @@ double BaseSocketCommunication<TSocketType>::SendString(
     SendSize(rData.size()); // serves also as synchronization for time measurement
 
     const auto start_time(std::chrono::steady_clock::now());
-    asio::write(*mpAsioSocket, asio::buffer(rData.data(), rData.size()));
+    WriteBuffers({asio::buffer(rData.data(), rData.size())});
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
@@ -91,7 +137,7 @@ double BaseSocketCommunication<TSocketType>::ReceiveString(
 
     const auto start_time(std::chrono::steady_clock::now());
     rData.resize(received_size);
-    asio::read(*mpAsioSocket, asio::buffer(&(rData.front()), received_size));
+    ReadBuffers({asio::buffer(&(rData.front()), received_size)});
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
@@ -107,7 +153,7 @@ double BaseSocketCommunication<TSocketType>::SendDataContainer(
     SendSize(rData.size()); // serves also as synchronization for time measurement
 
     const auto start_time(std::chrono::steady_clock::now());
-    asio::write(*mpAsioSocket, asio::buffer(rData.data(), rData.size()*sizeof(double)));
+    WriteBuffers({asio::buffer(rData.data(), rData.size()*sizeof(double))});
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
@@ -124,7 +170,58 @@ double BaseSocketCommunication<TSocketType>::ReceiveDataContainer(
 
     const auto start_time(std::chrono::steady_clock::now());
     rData.resize(received_size);
-    asio::read(*mpAsioSocket, asio::buffer(rData.data(), rData.size()*sizeof(double)));
+    ReadBuffers({asio::buffer(rData.data(), rData.size()*sizeof(double))});
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+double BaseSocketCommunication<TSocketType>::SendDataBuffers(
+    const Info& I_Info,
+    const std::string& rHeader,
+    const std::vector<ConstDataBufferType>& rBuffers)
+{
+    CO_SIM_IO_TRY
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    // size of the header, header and data are sent with one (gathering) write
+    const std::uint64_t header_size = rHeader.size();
+    std::vector<asio::const_buffer> buffers;
+    buffers.reserve(rBuffers.size()+2);
+    buffers.push_back(asio::buffer(&header_size, sizeof(header_size)));
+    buffers.push_back(asio::buffer(rHeader.data(), rHeader.size()));
+    for (const auto& r_buffer : rBuffers) {
+        buffers.push_back(asio::buffer(r_buffer.first, r_buffer.second));
+    }
+    WriteBuffers(buffers, 2);
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+double BaseSocketCommunication<TSocketType>::ReceiveDataBuffers(
+    const Info& I_Info,
+    const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived)
+{
+    CO_SIM_IO_TRY
+
+    const std::size_t header_size = ReceiveSize(); // serves also as synchronization for time measurement
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    std::string header(header_size, ' ');
+    asio::read(*mpAsioSocket, asio::buffer(&header[0], header_size));
+
+    std::vector<asio::mutable_buffer> buffers;
+    for (const auto& r_buffer : rHeaderReceived(header)) {
+        buffers.push_back(asio::buffer(r_buffer.first, r_buffer.second));
+    }
+    ReadBuffers(buffers);
+
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
@@ -145,6 +242,8 @@ std::uint64_t BaseSocketCommunication<TSocketType>::ReceiveSize()
 {
     CO_SIM_IO_TRY
 
+    PrepareReceive();
+
     std::uint64_t imp_size_u;
     asio::read(*mpAsioSocket, asio::buffer(&imp_size_u, sizeof(imp_size_u)));
     return imp_size_u;
@@ -152,6 +251,172 @@ std::uint64_t BaseSocketCommunication<TSocketType>::ReceiveSize()
     CO_SIM_IO_CATCH
 }
 
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::WriteBuffers(
+    const std::vector<asio::const_buffer>& rBuffers,
+    const std::size_t NumHeaderBuffers)
+{
+    CO_SIM_IO_TRY
+
+    const std::vector<asio::const_buffer> payload_buffers(rBuffers.begin()+NumHeaderBuffers, rBuffers.end());
+    const std::size_t payload_size = asio::buffer_size(payload_buffers);
+    const std::size_t num_stripes = GetNumStripes(payload_size);
+
+    if (num_stripes == 1) {
+        asio::write(*mpAsioSocket, rBuffers);
+        return;
+    }
+
+    ForEachStream(num_stripes, [&](const std::size_t Index){
+        std::vector<asio::const_buffer> buffers(rBuffers.begin(), rBuffers.begin()+(Index==0 ? NumHeaderBuffers : 0));
+        const auto stripe_buffers = GetBufferRange(payload_buffers, Index*payload_size/num_stripes, (Index+1)*payload_size/num_stripes);
+        buffers.insert(buffers.end(), stripe_buffers.begin(), stripe_buffers.end());
+        asio::write(GetStreamSocket(Index), buffers);
+    });
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::ReadBuffers(const std::vector<asio::mutable_buffer>& rBuffers)
+{
+    CO_SIM_IO_TRY
+
+    const std::size_t payload_size = asio::buffer_size(rBuffers);
+    const std::size_t num_stripes = GetNumStripes(payload_size);
+
+    if (num_stripes == 1) {
+        asio::read(*mpAsioSocket, rBuffers);
+        return;
+    }
+
+    ForEachStream(num_stripes, [&](const std::size_t Index){
+        asio::read(GetStreamSocket(Index), GetBufferRange(rBuffers, Index*payload_size/num_stripes, (Index+1)*payload_size/num_stripes));
+    });
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::StartStreamWorkers()
+{
+    CO_SIM_IO_TRY
+
+    for (std::size_t i=0; i<mpAsioStreamSockets.size(); ++i) {
+        mStreamWorkers.push_back(CoSimIO::make_unique<StreamWorker>());
+        StreamWorker& r_worker = *mStreamWorkers.back();
+        r_worker.Thread = std::thread([&r_worker](){
+            while (true) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(r_worker.Mutex);
+                    r_worker.TaskAvailable.wait(lock, [&r_worker](){return r_worker.Stop || !r_worker.Tasks.empty();});
+                    if (r_worker.Tasks.empty()) {return;} // only stopping once all tasks are completed
+                    task = std::move(r_worker.Tasks.front());
+                    r_worker.Tasks.pop_front();
+                }
+                task(); // exceptions are stored in the future
+            }
+        });
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::StopStreamWorkers()
+{
+    for (auto& rp_worker : mStreamWorkers) {
+        {
+            std::lock_guard<std::mutex> lock(rp_worker->Mutex);
+            rp_worker->Stop = true;
+        }
+        rp_worker->TaskAvailable.notify_one();
+
+        if (rp_worker->Thread.joinable()) {
+            rp_worker->Thread.join();
+        }
+    }
+    mStreamWorkers.clear();
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::ForEachStream(
+    const std::size_t NumStreams,
+    const std::function<void(const std::size_t)>& rFunction)
+{
+    CO_SIM_IO_TRY
+
+    // if the transfer of a stripe fails, then the transfers of the other stripes would block forever, on both sides
+    auto execute = [this, &rFunction](const std::size_t Index){
+        try {
+            rFunction(Index);
+        } catch (...) {
+            ShutdownSockets();
+            throw;
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(NumStreams-1);
+    for (std::size_t i=1; i<NumStreams; ++i) {
+        auto p_task = std::make_shared<std::packaged_task<void()>>([&execute, i](){execute(i);});
+        futures.push_back(p_task->get_future());
+
+        StreamWorker& r_worker = *mStreamWorkers[i-1];
+        {
+            std::lock_guard<std::mutex> lock(r_worker.Mutex);
+            r_worker.Tasks.push_back([p_task](){(*p_task)();});
+        }
+        r_worker.TaskAvailable.notify_one();
+    }
+
+    std::exception_ptr exception;
+    try {
+        execute(0);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    // waiting for all stripes, as they refer to the buffers of the caller
+    for (auto& r_future : futures) {
+        try {
+            r_future.get();
+        } catch (...) {
+            if (!exception) {exception = std::current_exception();}
+        }
+    }
+
+    if (exception) {std::rethrow_exception(exception);}
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::ShutdownSockets()
+{
+    // shutting down (instead of closing) is safe while other threads still use the sockets, it wakes up their blocking
+    // operations and the partner receives the end of the stream. The sockets are closed when disconnecting
+    asio::error_code ec; // errors are ignored, e.g. if the socket was already shut down
+    for (std::size_t i=0; i<mpAsioStreamSockets.size()+1; ++i) {
+        GetStreamSocket(i).shutdown(asio::socket_base::shutdown_both, ec);
+    }
+}
+
+template<class TSocketType>
+std::size_t BaseSocketCommunication<TSocketType>::GetNumStripes(const std::size_t PayloadSize) const
+{
+    // both partners compute the same number of stripes from the size of the payload
+    const std::size_t num_streams = mpAsioStreamSockets.size()+1;
+    return std::max<std::size_t>(1, std::min(num_streams, PayloadSize/MIN_STRIPE_SIZE));
+}
+
+template<class TSocketType>
+TSocketType& BaseSocketCommunication<TSocketType>::GetStreamSocket(const std::size_t Index)
+{
+    return (Index == 0) ? *mpAsioSocket : *mpAsioStreamSockets[Index-1];
+}
+
 template class BaseSocketCommunication<asio::ip::tcp::socket>;
 template class BaseSocketCommunication<asio::local::stream_protocol::socket>;
 
@@ -11,8 +11,15 @@
 //
 
 // System includes
+#include <algorithm>
+#include <cctype>
+#include <sstream>
 #include <thread>
+#include <cstdint>
+#include <cstring>
 #include <system_error>
+#include <unordered_map>
+#include <unordered_set>
 
 // Project includes
 #include "includes/communication/communication.hpp"
@@ -23,251 +30,1432 @@
 namespace CoSimIO {
 namespace Internals {
 
+namespace {
+
+Info CreateInfoForSkippedTransfer()
+{
+    Info info;
+    info.Set<double>("elapsed_time", 0.0);
+    info.Set<std::size_t>("memory_usage_ipc", 0);
+    return info;
+}
+
+// merges the meshes that were collected from several ranks into one
+// the partition indices of the ghost nodes are converted to the ranks of the partner,
+// ghost nodes that belong to the same partner rank as the merged mesh become local nodes
+void MergeModelParts(
+    const std::vector<const ModelPart*>& rModelParts,
+    const std::size_t MyRank,
+    const std::size_t MySize,
+    const std::size_t PartnerSize,
+    ModelPart& rMergedModelPart)
+{
+    CO_SIM_IO_TRY
+
+    std::unordered_set<IdType> node_ids;
+    for (const ModelPart* p_model_part : rModelParts) {
+        for (const auto& r_node : p_model_part->LocalNodes()) {
+            if (node_ids.insert(r_node.Id()).second) {
+                rMergedModelPart.CreateNewNode(r_node.Id(), r_node.X(), r_node.Y(), r_node.Z());
+            }
+        }
+    }
+
+    for (const ModelPart* p_model_part : rModelParts) {
+        std::unordered_map<IdType, int> ghost_node_partitions;
+        for (const auto& r_partition : p_model_part->GetPartitionModelParts()) {
+            for (const auto& r_node : r_partition.second->Nodes()) {
+                ghost_node_partitions[r_node.Id()] = r_partition.first;
+            }
+        }
+
+        for (const auto& r_node : p_model_part->GhostNodes()) {
+            const std::size_t owner_rank = static_cast<std::size_t>(ghost_node_partitions.at(r_node.Id()));
+            const std::size_t partner_rank = *Utilities::ComputePartnerRanksAsExporter(owner_rank, MySize, PartnerSize).begin();
+            if (partner_rank != MyRank && node_ids.insert(r_node.Id()).second) {
+                rMergedModelPart.CreateNewGhostNode(r_node.Id(), r_node.X(), r_node.Y(), r_node.Z(), static_cast<int>(partner_rank));
+            }
+        }
+    }
+
+    std::unordered_set<IdType> element_ids;
+    ConnectivitiesType connectivities;
+    for (const ModelPart* p_model_part : rModelParts) {
+        for (const auto& r_elem : p_model_part->Elements()) {
+            if (element_ids.insert(r_elem.Id()).second) {
+                connectivities.clear();
+                for (const auto& r_node : r_elem.Nodes()) {
+                    connectivities.push_back(r_node.Id());
+                }
+                rMergedModelPart.CreateNewElement(r_elem.Id(), r_elem.Type(), connectivities);
+            }
+        }
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+void HashCombine(std::size_t& rSeed, const std::size_t Value)
+{
+    rSeed ^= Value + 0x9e3779b9 + (rSeed<<6) + (rSeed>>2);
+}
+
+// hash of the ModelPart, the coordinates of the nodes are only considered if requested
+// without the coordinates this is the hash of the topology of the mesh
+std::size_t ComputeModelPartHash(
+    const ModelPart& rModelPart,
+    const bool IncludeCoordinates)
+{
+    CO_SIM_IO_TRY
+
+    std::size_t seed = std::hash<std::string>()(rModelPart.Name());
+    HashCombine(seed, rModelPart.NumberOfNodes());
+    HashCombine(seed, rModelPart.NumberOfElements());
+
+    std::hash<double> hash_double;
+    for (const auto& r_node : rModelPart.Nodes()) {
+        HashCombine(seed, r_node.Id());
+        if (IncludeCoordinates) {
+            HashCombine(seed, hash_double(r_node.X()));
+            HashCombine(seed, hash_double(r_node.Y()));
+            HashCombine(seed, hash_double(r_node.Z()));
+        }
+    }
+
+    // the partitions are stored unordered, hence their hashes are combined independent of the order
+    std::size_t partitions_seed = 0;
+    for (const auto& r_partition : rModelPart.GetPartitionModelParts()) {
+        std::size_t partition_seed = static_cast<std::size_t>(r_partition.first);
+        for (const auto& r_node : r_partition.second->Nodes()) {
+            HashCombine(partition_seed, r_node.Id());
+        }
+        partitions_seed += partition_seed;
+    }
+    HashCombine(seed, partitions_seed);
+
+    for (const auto& r_elem : rModelPart.Elements()) {
+        HashCombine(seed, r_elem.Id());
+        HashCombine(seed, static_cast<std::size_t>(r_elem.Type()));
+        for (const auto& r_node : r_elem.Nodes()) {
+            HashCombine(seed, r_node.Id());
+        }
+    }
+
+    return seed;
+
+    CO_SIM_IO_CATCH
+}
+
+// adds the time and memory of another transfer that was necessary for the same operation
+void AccumulateTransferInfo(Info& rInfo, const Info& rOtherInfo)
+{
+    rInfo.Set<double>("elapsed_time", rInfo.Get<double>("elapsed_time") + rOtherInfo.Get<double>("elapsed_time"));
+    rInfo.Set<std::size_t>("memory_usage_ipc", rInfo.Get<std::size_t>("memory_usage_ipc") + rOtherInfo.Get<std::size_t>("memory_usage_ipc"));
+}
+
+// entry of the header that is sent in front of directly transferred data (data batches and data of types other than double)
+struct DataHeaderEntry
+{
+    std::string Identifier;
+    DataType Type;
+    std::size_t Size;
+};
+
+// the header contains the number of containers and for each container its identifier, type and size
+std::string CreateDataHeader(const std::vector<DataHeaderEntry>& rEntries)
+{
+    std::string header;
+    auto append_size = [&header](const std::uint64_t Size){
+        header.append(reinterpret_cast<const char*>(&Size), sizeof(Size));
+    };
+
+    append_size(rEntries.size());
+    for (const auto& r_entry : rEntries) {
+        append_size(r_entry.Identifier.size());
+        header.append(r_entry.Identifier);
+        append_size(static_cast<std::uint64_t>(r_entry.Type));
+        append_size(r_entry.Size);
+    }
+
+    return header;
+}
+
+// parses the received header and checks it against the expected identifiers and types
+std::vector<DataHeaderEntry> ParseDataHeader(
+    const std::string& rHeader,
+    const std::vector<std::pair<std::string, DataType>>& rExpected)
+{
+    CO_SIM_IO_TRY
+
+    std::size_t pos = 0;
+    auto read_size = [&rHeader, &pos]() -> std::uint64_t {
+        CO_SIM_IO_ERROR_IF(pos+sizeof(std::uint64_t) > rHeader.size()) << "Received an invalid data header!" << std::endl;
+        std::uint64_t size;
+        std::memcpy(&size, rHeader.data()+pos, sizeof(size));
+        pos += sizeof(size);
+        return size;
+    };
+
+    const std::size_t num_containers = static_cast<std::size_t>(read_size());
+    CO_SIM_IO_ERROR_IF(num_containers != rExpected.size()) << "Mismatch in number of received data containers!\nExpected: " << rExpected.size() << "\nReceived: " << num_containers << std::endl;
+
+    std::vector<DataHeaderEntry> entries(num_containers);
+    for (std::size_t i=0; i<num_containers; ++i) {
+        const std::size_t identifier_size = static_cast<std::size_t>(read_size());
+        CO_SIM_IO_ERROR_IF(pos+identifier_size > rHeader.size()) << "Received an invalid data header!" << std::endl;
+        entries[i].Identifier = rHeader.substr(pos, identifier_size);
+        pos += identifier_size;
+        entries[i].Type = static_cast<DataType>(read_size());
+        entries[i].Size = static_cast<std::size_t>(read_size());
+
+        CO_SIM_IO_ERROR_IF(entries[i].Identifier != rExpected[i].first) << "Mismatch in identifiers of received data!\nExpected: \"" << rExpected[i].first << "\"\nReceived: \"" << entries[i].Identifier << "\"" << std::endl;
+        CO_SIM_IO_ERROR_IF(entries[i].Type != rExpected[i].second) << "Mismatch in type of received data \"" << entries[i].Identifier << "\"!\nExpected: " << DataTypeToString(rExpected[i].second) << "\nReceived: " << DataTypeToString(entries[i].Type) << std::endl;
+    }
+
+    return entries;
+
+    CO_SIM_IO_CATCH
+}
+
+template<typename TDataType>
+Communication::DataBufferType GetDataBuffer(DataContainer<TDataType>& rData)
+{
+    return {reinterpret_cast<char*>(rData.data()), rData.size()*sizeof(TDataType)};
+}
+
+template<typename TDataType>
+Communication::ConstDataBufferType GetDataBuffer(const DataContainer<TDataType>& rData)
+{
+    return {reinterpret_cast<const char*>(rData.data()), rData.size()*sizeof(TDataType)};
+}
+
+// the mesh update is sent under the identifier of the mesh with this suffix, hence it is reserved
+const std::string MESH_UPDATE_SUFFIX = "_mesh_update";
+
+// first entry of the mesh update that is sent before every mesh when using the incremental mesh export
+const double FULL_MESH_TRANSFER = 0.0;
+const double COORDINATES_TRANSFER = 1.0;
+
+// the hash of the topology is sent together with the coordinates, split in two parts that can be represented exactly as double
+const std::size_t TOPOLOGY_HASH_SIZE = 2;
+
+void AppendTopologyHash(std::vector<double>& rUpdate, const std::size_t TopologyHash)
+{
+    const std::uint64_t hash = static_cast<std::uint64_t>(TopologyHash);
+    rUpdate.push_back(static_cast<double>(hash >> 32));
+    rUpdate.push_back(static_cast<double>(hash & 0xFFFFFFFF));
+}
+
+std::size_t ExtractTopologyHash(const std::vector<double>& rUpdate)
+{
+    const std::uint64_t hash = (static_cast<std::uint64_t>(rUpdate[1]) << 32) | static_cast<std::uint64_t>(rUpdate[2]);
+    return static_cast<std::size_t>(hash);
+}
+
+// how a mesh is transferred when using the mesh cache, sent in the header before the mesh
+enum class MeshTransfer : std::uint64_t
+{
+    Full,        // the serialized mesh
+    Coordinates, // only the coordinates of the nodes, the topology is the same as for the previous mesh
+    Cached       // nothing, the importer already has the mesh
+};
+
+struct MeshCacheHeader
+{
+    MeshTransfer Transfer;
+    std::uint64_t Hash;         // hash of the mesh, incl. the coordinates of the nodes
+    std::uint64_t TopologyHash; // only used with the incremental mesh export
+    std::uint64_t PayloadSize;  // number of bytes that are sent after the header
+};
+
+std::string CreateMeshCacheHeader(const MeshCacheHeader& rHeader)
+{
+    return std::string(reinterpret_cast<const char*>(&rHeader), sizeof(rHeader));
+}
+
+MeshCacheHeader ParseMeshCacheHeader(const std::string& rHeader)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF(rHeader.size() != sizeof(MeshCacheHeader)) << "Received an invalid mesh header!" << std::endl;
+    MeshCacheHeader header;
+    std::memcpy(&header, rHeader.data(), sizeof(header));
+    CO_SIM_IO_ERROR_IF(header.Transfer > MeshTransfer::Cached) << "Received an invalid mesh header!" << std::endl;
+    return header;
+
+    CO_SIM_IO_CATCH
+}
+
+} // anonymous namespace
+
 void AddFilePermissions(const fs::path& rPath)
 {
     CO_SIM_IO_TRY
 
-    fs::permissions(rPath,
-        fs::perms::owner_read  | fs::perms::owner_write |
-        fs::perms::group_read  | fs::perms::group_write |
-        fs::perms::others_read | fs::perms::others_write,
-        fs::perm_options::add);
+    fs::permissions(rPath,
+        fs::perms::owner_read  | fs::perms::owner_write |
+        fs::perms::group_read  | fs::perms::group_write |
+        fs::perms::others_read | fs::perms::others_write,
+        fs::perm_options::add);
+
+    CO_SIM_IO_CATCH
+}
+
+Communication::Communication(
+    const Info& I_Settings,
+    std::shared_ptr<DataCommunicator> I_DataComm)
+    : mpDataComm(I_DataComm),
+      mMyName(I_Settings.Get<std::string>("my_name")),
+      mConnectTo(I_Settings.Get<std::string>("connect_to")),
+      mAlwaysUseSerializer(I_Settings.Get<bool>("always_use_serializer", false)),
+      mUseIncrementalMeshExport(I_Settings.Get<bool>("use_incremental_mesh_export", false)),
+      mUseMeshCache(I_Settings.Get<bool>("use_mesh_cache", false)),
+      mWorkingDirectory(I_Settings.Get<std::string>("working_directory", fs::relative(fs::current_path()).string())),
+      mEchoLevel(I_Settings.Get<int>("echo_level", 0)),
+      mPrintTiming(I_Settings.Get<bool>("print_timing", false)),
+      mPrintStatistics(I_Settings.Get<bool>("print_statistics", false)),
+      mTraceFile(I_Settings.Get<std::string>("trace_file", "")),
+      mTracer(!mTraceFile.empty(), mMyName)
+{
+    CO_SIM_IO_TRY
+
+    if (I_Settings.Has("is_primary_connection")) {
+        mIsPrimaryConnection = I_Settings.Get<bool>("is_primary_connection");
+        mPrimaryWasExplicitlySpecified = true;
+    } else {
+        // automatically determine the primary connection in case the user didn't specify it
+        mIsPrimaryConnection = mMyName < mConnectTo;
+        mPrimaryWasExplicitlySpecified = false;
+    }
+    mConnectionName = Utilities::CreateConnectionName(mMyName, mConnectTo);
+
+    CO_SIM_IO_ERROR_IF_NOT(fs::exists(mWorkingDirectory)) << "The working directory " << mWorkingDirectory << " does not exist!" << std::endl;
+
+    if (I_Settings.Has("serializer_trace_type")) {
+        mSerializerTraceType = Serializer::StringToTraceType(I_Settings.Get<std::string>("serializer_trace_type"));
+    }
+
+    mCompression = Compression::StringToCompressionType(I_Settings.Get<std::string>("compression", "none"));
+
+    mCommInFolder = I_Settings.Get<bool>("use_folder_for_communication", true);
+    mCommFolder = GetWorkingDirectory();
+    if (mCommInFolder) {
+        mCommFolder /= ".CoSimIOComm_" + GetConnectionName();
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+Communication::~Communication() noexcept(false)
+{
+    // the derived class is already destructed at this point,
+    // but the thread is joined in any case to not terminate the program
+    StopAsyncThread();
+}
+
+Info Communication::Connect(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0)
+        << "Establishing connection for \"" << mConnectionName
+        << "\"\n    from: \"" << mMyName
+        << "\"\n    to:   \"" << mConnectTo
+        << "\"\n    as " << (mIsPrimaryConnection ? "PRIMARY" : "SECONDARY")
+        << " connection; working directory: " << mWorkingDirectory << " ..." << std::endl;
+
+    CO_SIM_IO_ERROR_IF(mIsConnected) << "A connection was already established!" << std::endl;
+
+    mStatistics.Clear();
+    mTracer.Clear();
+
+    Info connect_detail_info;
+    {
+        const Tracer::Scope trace_scope(mTracer, "connect", "connection");
+
+        BaseConnectDetail(I_Info);
+
+        PrepareConnection(I_Info);
+
+        HandShake(I_Info);
+
+        connect_detail_info = ConnectDetail(I_Info);
+    }
+    mIsConnected = true;
+    connect_detail_info.Set<bool>("is_connected", true);
+    connect_detail_info.Set<int>("connection_status", ConnectionStatus::Connected);
+    connect_detail_info.Set<std::string>("working_directory", mWorkingDirectory.string());
+
+    CO_SIM_IO_ERROR_IF_NOT(mIsConnected) << "Connection was not successful!" << std::endl;
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Connection established" << std::endl;
+
+    return connect_detail_info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::Disconnect(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Disconnecting \"" << mConnectionName << "\" ..." << std::endl;
+
+    if (mIsConnected) {
+        Info disconnect_detail_info;
+        { // the event has to be completed before the trace is written
+            const Tracer::Scope trace_scope(mTracer, "disconnect", "connection");
+
+            StopAsyncThread(); // completes all pending asynchronous operations
+
+            if (mPrintStatistics && mpDataComm->Rank() == 0) {
+                std::stringstream statistics;
+                mStatistics.Print(statistics);
+                CO_SIM_IO_INFO("CoSimIO-Statistics") << "Statistics of \"" << mConnectionName << "\":\n" << statistics.str() << std::flush;
+            }
+
+            disconnect_detail_info = DisconnectDetail(I_Info);
+            mIsConnected = false;
+            disconnect_detail_info.Set<bool>("is_connected", false);
+            disconnect_detail_info.Set<Info>("statistics", mStatistics.GetInfo());
+
+            BaseDisconnectDetail(I_Info);
+        }
+
+        WriteTrace();
+
+        if (mIsConnected) {
+            CO_SIM_IO_INFO("CoSimIO") << "Warning: Disconnect was not successful!" << std::endl;
+            disconnect_detail_info.Set<int>("connection_status", ConnectionStatus::DisconnectionError);
+        } else {
+            CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Disconnecting successful" << std::endl;
+            disconnect_detail_info.Set<int>("connection_status", ConnectionStatus::Disconnected);
+        }
+        return disconnect_detail_info;
+
+    } else {
+        CO_SIM_IO_INFO("CoSimIO") << "Warning: Calling Disconnect but there was no active connection!" << std::endl;
+        Info disconnect_info;
+        disconnect_info.Set<bool>("is_connected", false);
+        disconnect_info.Set<int>("connection_status", ConnectionStatus::DisconnectionError);
+        return disconnect_info;
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+std::shared_ptr<DataCommunicator> Communication::GetMergedDataCommunicator() const
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR << "A merged data communicator is not available for communication format \"" << GetCommunicationName() << "\"!" << std::endl;
+
+    return nullptr;
+
+    CO_SIM_IO_CATCH
+}
+
+void Communication::BaseConnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    if (mCommInFolder && GetIsPrimaryConnection() && mpDataComm->Rank() == 0) {
+        // delete and recreate directory to remove potential leftovers
+        std::error_code ec;
+        fs::remove_all(mCommFolder, ec);
+        CO_SIM_IO_INFO_IF("CoSimIO", ec) << "Warning, communication directory (" << mCommFolder << ") could not be deleted!\nError code: " << ec.message() << std::endl;
+        if (!fs::exists(mCommFolder)) {
+            fs::create_directory(mCommFolder);
+            AddFilePermissions(mCommFolder); // otherwise the process with lower rights cannot delete files in it
+        }
+    }
+
+    SynchronizeAll("conn");
+
+    CO_SIM_IO_CATCH
+}
+
+void Communication::BaseDisconnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    SynchronizeAll("disconn");
+
+    if (mCommInFolder && GetIsPrimaryConnection() && mpDataComm->Rank() == 0) {
+        // delete directory to remove potential leftovers
+        std::error_code ec;
+        fs::remove_all(mCommFolder, ec);
+        if (ec) {
+            CO_SIM_IO_INFO("CoSimIO") << "Warning, communication directory (" << mCommFolder << ") could not be deleted!\nError code: " << ec.message() << std::endl;
+        }
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportInfoImpl(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    Info imported_info;
+    Info rec_info = ReceiveObjectWithStreamSerializer(I_Info, imported_info);
+    imported_info.Set<double>("elapsed_time", rec_info.Get<double>("elapsed_time"));
+    imported_info.Set<double>("elapsed_time_ipc", rec_info.Get<double>("elapsed_time_ipc"));
+    imported_info.Set<double>("elapsed_time_serializer", rec_info.Get<double>("elapsed_time_serializer"));
+    imported_info.Set<std::size_t>("memory_usage_ipc", rec_info.Get<std::size_t>("memory_usage_ipc"));
+    return imported_info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportInfoImpl(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    return SendObjectWithStreamSerializer(I_Info, I_Info);
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportDataImpl(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    if (mAlwaysUseSerializer) {
+        return ReceiveObjectWithStreamSerializer(I_Info, rData);
+    } else if (mCompression == Compression::CompressionType::Fpc) {
+        std::string compressed_data;
+        double elapsed_time_read;
+        {
+            const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+            elapsed_time_read = ReceiveString(I_Info, compressed_data);
+        }
+
+        const auto start_time(std::chrono::steady_clock::now());
+        {
+            const Tracer::Scope trace_scope(mTracer, "compression", "phase");
+            Compression::DecompressFpc(compressed_data, rData);
+        }
+        const double elapsed_time_decompress = Utilities::ElapsedSeconds(start_time);
+
+        Info info;
+        info.Set<double>("elapsed_time", elapsed_time_read+elapsed_time_decompress);
+        info.Set<double>("elapsed_time_ipc", elapsed_time_read);
+        info.Set<double>("elapsed_time_compression", elapsed_time_decompress);
+        info.Set<std::size_t>("memory_usage_ipc", compressed_data.size());
+        return info;
+    } else {
+        const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+        Info info;
+        const double elapsed_time = ReceiveDataContainer(I_Info, rData);
+        info.Set<double>("elapsed_time", elapsed_time);
+        info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(double));
+        return info;
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportDataImpl(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    if (mAlwaysUseSerializer) {
+        return SendObjectWithStreamSerializer(I_Info, rData);
+    } else if (mCompression == Compression::CompressionType::Fpc) {
+        const auto start_time(std::chrono::steady_clock::now());
+        std::string compressed_data;
+        {
+            const Tracer::Scope trace_scope(mTracer, "compression", "phase");
+            compressed_data = Compression::CompressFpc(rData.data(), rData.size());
+        }
+        const double elapsed_time_compress = Utilities::ElapsedSeconds(start_time);
+
+        double elapsed_time_write;
+        {
+            const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+            elapsed_time_write = SendString(I_Info, compressed_data);
+        }
+
+        Info info;
+        info.Set<double>("elapsed_time", elapsed_time_write+elapsed_time_compress);
+        info.Set<double>("elapsed_time_ipc", elapsed_time_write);
+        info.Set<double>("elapsed_time_compression", elapsed_time_compress);
+        info.Set<std::size_t>("memory_usage_ipc", compressed_data.size());
+        return info;
+    } else {
+        const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+        Info info;
+        const double elapsed_time = SendDataContainer(I_Info, rData);
+        info.Set<double>("elapsed_time", elapsed_time);
+        info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(double));
+        return info;
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportDataBatchImpl(
+    const Info& I_Info,
+    const DataBatchType& rData)
+{
+    CO_SIM_IO_TRY
+
+    if (mAlwaysUseSerializer || mCompression != Compression::CompressionType::None) {
+        // the containers are exchanged (and compressed) one by one
+        Info info = CreateInfoForSkippedTransfer();
+        for (const auto& r_data : rData) {
+            Info data_info(I_Info);
+            data_info.Set<std::string>("identifier", r_data.first);
+            AccumulateTransferInfo(info, ImportDataImpl(data_info, *r_data.second));
+        }
+        return info;
+    }
+
+    const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+    const double elapsed_time = ReceiveDataBuffers(I_Info, [&rData](const std::string& rHeader){
+        std::vector<std::pair<std::string, DataType>> expected;
+        for (const auto& r_data : rData) {
+            expected.emplace_back(r_data.first, DataType::Double);
+        }
+        const std::vector<DataHeaderEntry> entries = ParseDataHeader(rHeader, expected);
+
+        std::vector<DataBufferType> buffers;
+        buffers.reserve(rData.size());
+        for (std::size_t i=0; i<rData.size(); ++i) {
+            rData[i].second->resize(entries[i].Size);
+            buffers.push_back(GetDataBuffer(*rData[i].second));
+        }
+        return buffers;
+    });
+
+    std::size_t memory_usage = 0;
+    for (const auto& r_data : rData) {
+        memory_usage += r_data.second->size()*sizeof(double);
+    }
+
+    Info info;
+    info.Set<double>("elapsed_time", elapsed_time);
+    info.Set<std::size_t>("memory_usage_ipc", memory_usage);
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportDataBatchImpl(
+    const Info& I_Info,
+    const ConstDataBatchType& rData)
+{
+    CO_SIM_IO_TRY
+
+    if (mAlwaysUseSerializer || mCompression != Compression::CompressionType::None) {
+        Info info = CreateInfoForSkippedTransfer();
+        for (const auto& r_data : rData) {
+            Info data_info(I_Info);
+            data_info.Set<std::string>("identifier", r_data.first);
+            AccumulateTransferInfo(info, ExportDataImpl(data_info, *r_data.second));
+        }
+        return info;
+    }
+
+    std::vector<DataHeaderEntry> entries;
+    std::vector<ConstDataBufferType> buffers;
+    entries.reserve(rData.size());
+    buffers.reserve(rData.size());
+    std::size_t memory_usage = 0;
+    for (const auto& r_data : rData) {
+        entries.push_back({r_data.first, DataType::Double, r_data.second->size()});
+        buffers.push_back(GetDataBuffer(*r_data.second));
+        memory_usage += buffers.back().second;
+    }
+
+    const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+    Info info;
+    info.Set<double>("elapsed_time", SendDataBuffers(I_Info, CreateDataHeader(entries), buffers));
+    info.Set<std::size_t>("memory_usage_ipc", memory_usage);
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+double Communication::SendDataBuffers(
+    const Info& I_Info,
+    const std::string& rHeader,
+    const std::vector<ConstDataBufferType>& rBuffers)
+{
+    CO_SIM_IO_TRY
+
+    std::size_t total_size = 0;
+    for (const auto& r_buffer : rBuffers) {
+        total_size += r_buffer.second;
+    }
+
+    std::string data;
+    data.reserve(total_size);
+    for (const auto& r_buffer : rBuffers) {
+        if (r_buffer.second > 0) {
+            data.append(r_buffer.first, r_buffer.second);
+        }
+    }
+
+    const double elapsed_time_header = SendString(I_Info, rHeader);
+    return elapsed_time_header + SendString(I_Info, data);
+
+    CO_SIM_IO_CATCH
+}
+
+double Communication::ReceiveDataBuffers(
+    const Info& I_Info,
+    const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived)
+{
+    CO_SIM_IO_TRY
+
+    std::string header;
+    double elapsed_time = ReceiveString(I_Info, header);
+
+    const std::vector<DataBufferType> buffers = rHeaderReceived(header);
+
+    std::string data;
+    elapsed_time += ReceiveString(I_Info, data);
+
+    std::size_t total_size = 0;
+    for (const auto& r_buffer : buffers) {
+        total_size += r_buffer.second;
+    }
+    CO_SIM_IO_ERROR_IF(total_size != data.size()) << "Received " << data.size() << " bytes of data, but " << total_size << " were expected!" << std::endl;
+
+    std::size_t pos = 0;
+    for (const auto& r_buffer : buffers) {
+        if (r_buffer.second > 0) {
+            std::memcpy(r_buffer.first, data.data()+pos, r_buffer.second);
+            pos += r_buffer.second;
+        }
+    }
+
+    return elapsed_time;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportMeshImpl(
+    const Info& I_Info,
+    ModelPart& O_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    return ReceiveObjectWithStreamSerializer(I_Info, O_ModelPart);
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportMeshImpl(
+    const Info& I_Info,
+    const ModelPart& I_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    return SendObjectWithStreamSerializer(I_Info, I_ModelPart);
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportMeshCached(
+    const Info& I_Info,
+    ModelPart& O_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    if (!mUseMeshCache) {
+        return ImportMeshIncremental(I_Info, O_ModelPart);
+    }
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    // the header and the mesh (or the coordinates of its nodes) are received as one message, without a round trip
+    MeshCacheHeader header;
+    std::string data;
+    std::vector<double> coordinates;
+    double elapsed_time_read;
+    {
+        const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+        elapsed_time_read = ReceiveDataBuffers(I_Info, [&](const std::string& rHeader){
+            header = ParseMeshCacheHeader(rHeader);
+            const std::size_t payload_size = static_cast<std::size_t>(header.PayloadSize);
+            if (header.Transfer == MeshTransfer::Full) {
+                data.resize(payload_size);
+                return std::vector<DataBufferType>{{&data[0], payload_size}};
+            } else if (header.Transfer == MeshTransfer::Coordinates) {
+                CO_SIM_IO_ERROR_IF(payload_size % (3*sizeof(double)) != 0) << "Received an invalid size of the coordinates: " << payload_size << std::endl;
+                coordinates.resize(payload_size/sizeof(double));
+                return std::vector<DataBufferType>{{reinterpret_cast<char*>(coordinates.data()), payload_size}};
+            }
+            return std::vector<DataBufferType>();
+        });
+    }
+
+    const auto start_time(std::chrono::steady_clock::now());
+    const Tracer::Scope trace_scope(mTracer, "serializer", "phase");
+
+    // the importer does not keep a copy of the mesh, the ModelPart itself is the cache. Its hash is computed
+    // after importing, which is also consistent if the serialization does not reproduce the coordinates exactly (ascii)
+    Info info;
+    if (header.Transfer == MeshTransfer::Full) {
+        StreamSerializer serializer(data, mSerializerTraceType);
+        serializer.load("object", O_ModelPart);
+        info.Set<std::string>("mesh_transfer", "full");
+    } else {
+        auto it_mesh = mImportedMeshes.find(identifier);
+        CO_SIM_IO_ERROR_IF(it_mesh == mImportedMeshes.end()) << "The mesh \"" << identifier << "\" is not in the mesh cache!" << std::endl;
+        const ImportedMesh& r_mesh = it_mesh->second;
+
+        if (header.Transfer == MeshTransfer::Coordinates) {
+            CO_SIM_IO_ERROR_IF(ComputeModelPartHash(O_ModelPart, false) != static_cast<std::size_t>(header.TopologyHash)) << "The topology of ModelPart \"" << O_ModelPart.Name() << "\" does not match the topology of the exported mesh! The mesh must be imported into the same ModelPart as previously when using \"use_mesh_cache\"" << std::endl;
+            CO_SIM_IO_ERROR_IF(coordinates.size() != 3*O_ModelPart.NumberOfNodes()) << "Received coordinates of " << coordinates.size()/3 << " nodes, but ModelPart \"" << O_ModelPart.Name() << "\" has " << O_ModelPart.NumberOfNodes() << " nodes!" << std::endl;
+
+            std::size_t i = 0;
+            for (auto it_node = O_ModelPart.NodesBegin(); it_node != O_ModelPart.NodesEnd(); ++it_node) {
+                (*it_node)->SetCoordinates(coordinates[i], coordinates[i+1], coordinates[i+2]);
+                i += 3;
+            }
+            info.Set<std::string>("mesh_transfer", "coordinates");
+        } else {
+            CO_SIM_IO_ERROR_IF(r_mesh.Hash != static_cast<std::size_t>(header.Hash)) << "The mesh \"" << identifier << "\" in the mesh cache does not match the exported mesh!" << std::endl;
+            CO_SIM_IO_ERROR_IF(ComputeModelPartHash(O_ModelPart, true) != r_mesh.ImportedHash) << "ModelPart \"" << O_ModelPart.Name() << "\" does not contain the mesh \"" << identifier << "\" that is in the mesh cache! The mesh must be imported into the same (unmodified) ModelPart as previously when using \"use_mesh_cache\"" << std::endl;
+            info.Set<std::string>("mesh_transfer", "cached");
+        }
+    }
+
+    if (header.Transfer != MeshTransfer::Cached) {
+        mImportedMeshes[identifier] = {static_cast<std::size_t>(header.Hash), ComputeModelPartHash(O_ModelPart, true)};
+    }
+
+    const double elapsed_time_load = Utilities::ElapsedSeconds(start_time);
+
+    info.Set<double>("elapsed_time", elapsed_time_read+elapsed_time_load);
+    info.Set<double>("elapsed_time_ipc", elapsed_time_read);
+    info.Set<double>("elapsed_time_serializer", elapsed_time_load);
+    info.Set<std::size_t>("memory_usage_ipc", static_cast<std::size_t>(header.PayloadSize));
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportMeshCached(
+    const Info& I_Info,
+    const ModelPart& I_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    if (!mUseMeshCache) {
+        return ExportMeshIncremental(I_Info, I_ModelPart);
+    }
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    // the hash decides whether the partner already has the mesh, the mesh is only serialized if it has to be sent
+    const auto start_time(std::chrono::steady_clock::now());
+    MeshCacheHeader header {MeshTransfer::Full, ComputeModelPartHash(I_ModelPart, true), 0, 0};
+
+    // the partner keeps the last mesh that was exported with this identifier
+    std::string data;
+    std::vector<double> coordinates;
+    std::vector<ConstDataBufferType> buffers;
+    const auto it_mesh = mExportedMeshes.find(identifier);
+    const bool has_mesh = it_mesh != mExportedMeshes.end();
+
+    if (has_mesh && it_mesh->second.Hash == header.Hash) {
+        header.Transfer = MeshTransfer::Cached;
+    } else {
+        if (mUseIncrementalMeshExport) {
+            header.TopologyHash = ComputeModelPartHash(I_ModelPart, false);
+            if (has_mesh && it_mesh->second.TopologyHash == header.TopologyHash) {
+                header.Transfer = MeshTransfer::Coordinates;
+                coordinates.reserve(3*I_ModelPart.NumberOfNodes());
+                for (const auto& r_node : I_ModelPart.Nodes()) {
+                    coordinates.push_back(r_node.X());
+                    coordinates.push_back(r_node.Y());
+                    coordinates.push_back(r_node.Z());
+                }
+                buffers.push_back({reinterpret_cast<const char*>(coordinates.data()), coordinates.size()*sizeof(double)});
+            }
+        }
+
+        if (header.Transfer == MeshTransfer::Full) {
+            const Tracer::Scope trace_scope(mTracer, "serializer", "phase");
+            StreamSerializer serializer(mSerializerTraceType);
+            serializer.save("object", I_ModelPart);
+            data = serializer.GetStringRepresentation();
+            buffers.push_back({data.data(), data.size()});
+        }
+
+        mExportedMeshes[identifier] = {static_cast<std::size_t>(header.Hash), static_cast<std::size_t>(header.TopologyHash)};
+    }
+    header.PayloadSize = buffers.empty() ? 0 : buffers[0].second;
+    const double elapsed_time_save = Utilities::ElapsedSeconds(start_time);
+
+    double elapsed_time_write;
+    {
+        const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+        elapsed_time_write = SendDataBuffers(I_Info, CreateMeshCacheHeader(header), buffers);
+    }
+
+    const char* transfer_names[] = {"full", "coordinates", "cached"};
+
+    Info info;
+    info.Set<std::string>("mesh_transfer", transfer_names[static_cast<std::size_t>(header.Transfer)]);
+    info.Set<double>("elapsed_time", elapsed_time_write+elapsed_time_save);
+    info.Set<double>("elapsed_time_ipc", elapsed_time_write);
+    info.Set<double>("elapsed_time_serializer", elapsed_time_save);
+    info.Set<std::size_t>("memory_usage_ipc", static_cast<std::size_t>(header.PayloadSize));
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportMeshIncremental(
+    const Info& I_Info,
+    ModelPart& O_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    if (!mUseIncrementalMeshExport) {
+        return ImportMeshImpl(I_Info, O_ModelPart);
+    }
+
+    Info update_info(I_Info);
+    update_info.Set<std::string>("identifier", I_Info.Get<std::string>("identifier") + MESH_UPDATE_SUFFIX);
+
+    std::vector<double> update;
+    DataContainerStdVector<double> update_container(update);
+    Info update_result = ImportDataImpl(update_info, update_container);
+
+    CO_SIM_IO_ERROR_IF(update.empty()) << "Received an empty mesh update!" << std::endl;
+
+    if (update[0] == FULL_MESH_TRANSFER) {
+        Info info = ImportMeshImpl(I_Info, O_ModelPart);
+        AccumulateTransferInfo(info, update_result);
+        info.Set<std::string>("mesh_transfer", "full");
+        return info;
+    }
+
+    const std::size_t num_nodes = O_ModelPart.NumberOfNodes();
+    CO_SIM_IO_ERROR_IF(update.size() != 3*num_nodes+TOPOLOGY_HASH_SIZE+1) << "Received coordinates of " << (update.size()-TOPOLOGY_HASH_SIZE-1)/3 << " nodes, but ModelPart \"" << O_ModelPart.Name() << "\" has " << num_nodes << " nodes! The mesh must be imported into the same ModelPart as previously when using \"use_incremental_mesh_export\"" << std::endl;
+
+    // the coordinates are assigned in the order of the nodes, hence the topology (incl. Ids and connectivities) has to be the same
+    CO_SIM_IO_ERROR_IF(ExtractTopologyHash(update) != ComputeModelPartHash(O_ModelPart, false)) << "The topology of ModelPart \"" << O_ModelPart.Name() << "\" does not match the topology of the exported mesh! The mesh must be imported into the same ModelPart as previously when using \"use_incremental_mesh_export\"" << std::endl;
+
+    std::size_t i = TOPOLOGY_HASH_SIZE+1;
+    for (auto it_node = O_ModelPart.NodesBegin(); it_node != O_ModelPart.NodesEnd(); ++it_node) {
+        (*it_node)->SetCoordinates(update[i], update[i+1], update[i+2]);
+        i += 3;
+    }
+
+    update_result.Set<std::string>("mesh_transfer", "coordinates");
+    return update_result;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportMeshIncremental(
+    const Info& I_Info,
+    const ModelPart& I_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    if (!mUseIncrementalMeshExport) {
+        return ExportMeshImpl(I_Info, I_ModelPart);
+    }
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+    Info update_info(I_Info);
+    update_info.Set<std::string>("identifier", identifier + MESH_UPDATE_SUFFIX);
+
+    const std::size_t topology_hash = ComputeModelPartHash(I_ModelPart, false);
+    const auto it_topology = mExportedMeshTopologies.find(identifier);
+
+    if (it_topology == mExportedMeshTopologies.end() || it_topology->second != topology_hash) {
+        const std::vector<double> update {FULL_MESH_TRANSFER};
+        const Info update_result = ExportDataImpl(update_info, DataContainerStdVectorReadOnly<double>(update));
+
+        Info info = ExportMeshImpl(I_Info, I_ModelPart);
+        mExportedMeshTopologies[identifier] = topology_hash;
+
+        AccumulateTransferInfo(info, update_result);
+        info.Set<std::string>("mesh_transfer", "full");
+        return info;
+    }
+
+    // the topology is unchanged, hence only the coordinates are sent, in the order of the nodes
+    std::vector<double> update;
+    update.reserve(3*I_ModelPart.NumberOfNodes()+TOPOLOGY_HASH_SIZE+1);
+    update.push_back(COORDINATES_TRANSFER);
+    AppendTopologyHash(update, topology_hash);
+    for (const auto& r_node : I_ModelPart.Nodes()) {
+        update.push_back(r_node.X());
+        update.push_back(r_node.Y());
+        update.push_back(r_node.Z());
+    }
+
+    Info info = ExportDataImpl(update_info, DataContainerStdVectorReadOnly<double>(update));
+    info.Set<std::string>("mesh_transfer", "coordinates");
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportInfoFromPartnerRanks(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    if (HasSameSizeAsPartner()) {
+        return ImportInfoImpl(I_Info);
+    }
+
+    // Info is not distributed, hence it is only exchanged between the first ranks and then shared
+    Info imported_info;
+    if (mpDataComm->Rank() == 0) {
+        imported_info = ImportInfoImpl(I_Info);
+    }
+    mpDataComm->Broadcast(imported_info, 0);
+    return imported_info;
 
     CO_SIM_IO_CATCH
 }
 
-Communication::Communication(
-    const Info& I_Settings,
-    std::shared_ptr<DataCommunicator> I_DataComm)
-    : mpDataComm(I_DataComm),
-      mMyName(I_Settings.Get<std::string>("my_name")),
-      mConnectTo(I_Settings.Get<std::string>("connect_to")),
-      mAlwaysUseSerializer(I_Settings.Get<bool>("always_use_serializer", false)),
-      mWorkingDirectory(I_Settings.Get<std::string>("working_directory", fs::relative(fs::current_path()).string())),
-      mEchoLevel(I_Settings.Get<int>("echo_level", 0)),
-      mPrintTiming(I_Settings.Get<bool>("print_timing", false))
+Info Communication::ExportInfoToPartnerRanks(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
-    if (I_Settings.Has("is_primary_connection")) {
-        mIsPrimaryConnection = I_Settings.Get<bool>("is_primary_connection");
-        mPrimaryWasExplicitlySpecified = true;
-    } else {
-        // automatically determine the primary connection in case the user didn't specify it
-        mIsPrimaryConnection = mMyName < mConnectTo;
-        mPrimaryWasExplicitlySpecified = false;
+    if (HasSameSizeAsPartner()) {
+        return ExportInfoImpl(I_Info);
     }
-    mConnectionName = Utilities::CreateConnectionName(mMyName, mConnectTo);
 
-    CO_SIM_IO_ERROR_IF_NOT(fs::exists(mWorkingDirectory)) << "The working directory " << mWorkingDirectory << " does not exist!" << std::endl;
+    if (mpDataComm->Rank() == 0) {
+        return ExportInfoImpl(I_Info);
+    }
+    return CreateInfoForSkippedTransfer();
 
-    if (I_Settings.Has("serializer_trace_type")) {
-        mSerializerTraceType = Serializer::StringToTraceType(I_Settings.Get<std::string>("serializer_trace_type"));
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportDataFromPartnerRanks(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    if (HasSameSizeAsPartner() || !Utilities::ComputePartnerRanksAsImporter(mpDataComm->Rank(), mpDataComm->Size(), mPartnerSize).empty()) {
+        return ImportDataImpl(I_Info, rData);
     }
 
-    mCommInFolder = I_Settings.Get<bool>("use_folder_for_communication", true);
-    mCommFolder = GetWorkingDirectory();
-    if (mCommInFolder) {
-        mCommFolder /= ".CoSimIOComm_" + GetConnectionName();
+    // no partner rank sends data to this rank
+    rData.resize(0);
+    return CreateInfoForSkippedTransfer();
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportDataToPartnerRanks(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    if (HasSameSizeAsPartner()) {
+        return ExportDataImpl(I_Info, rData);
+    }
+
+    const int my_rank = mpDataComm->Rank();
+    const std::vector<int> ranks_to_collect_from = GetRanksToCollectFrom();
+
+    // first receive from the other ranks, then send to the collecting rank
+    // data is always sent to lower ranks, hence this cannot deadlock
+    std::vector<double> collected_data;
+    std::vector<double> received_data;
+    for (const int rank : ranks_to_collect_from) {
+        if (rank == my_rank) {
+            collected_data.insert(collected_data.end(), rData.data(), rData.data()+rData.size());
+        } else {
+            mpDataComm->Recv(received_data, rank);
+            collected_data.insert(collected_data.end(), received_data.begin(), received_data.end());
+        }
+    }
+
+    const int rank_to_collect_on = GetRankToCollectOn();
+    if (rank_to_collect_on != my_rank) {
+        mpDataComm->Send(std::vector<double>(rData.data(), rData.data()+rData.size()), rank_to_collect_on);
+    }
+
+    if (ranks_to_collect_from.empty()) {
+        return CreateInfoForSkippedTransfer();
+    } else if (ranks_to_collect_from.size() == 1 && ranks_to_collect_from[0] == my_rank) {
+        return ExportDataImpl(I_Info, rData);
+    } else {
+        const DataContainerStdVectorReadOnly<double> collected_data_container(collected_data);
+        return ExportDataImpl(I_Info, collected_data_container);
     }
 
     CO_SIM_IO_CATCH
 }
 
-Info Communication::Connect(const Info& I_Info)
+Info Communication::ImportDataBatchFromPartnerRanks(
+    const Info& I_Info,
+    const DataBatchType& rData)
 {
     CO_SIM_IO_TRY
 
-    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0)
-        << "Establishing connection for \"" << mConnectionName
-        << "\"\n    from: \"" << mMyName
-        << "\"\n    to:   \"" << mConnectTo
-        << "\"\n    as " << (mIsPrimaryConnection ? "PRIMARY" : "SECONDARY")
-        << " connection; working directory: " << mWorkingDirectory << " ..." << std::endl;
+    if (HasSameSizeAsPartner()) {
+        return ImportDataBatchImpl(I_Info, rData);
+    }
 
-    CO_SIM_IO_ERROR_IF(mIsConnected) << "A connection was already established!" << std::endl;
+    // the data has to be redistributed, which is done for each container separately
+    Info info = CreateInfoForSkippedTransfer();
+    for (const auto& r_data : rData) {
+        Info data_info(I_Info);
+        data_info.Set<std::string>("identifier", r_data.first);
+        AccumulateTransferInfo(info, ImportDataFromPartnerRanks(data_info, *r_data.second));
+    }
+    return info;
 
-    BaseConnectDetail(I_Info);
+    CO_SIM_IO_CATCH
+}
 
-    PrepareConnection(I_Info);
+Info Communication::ExportDataBatchToPartnerRanks(
+    const Info& I_Info,
+    const ConstDataBatchType& rData)
+{
+    CO_SIM_IO_TRY
 
-    HandShake(I_Info);
+    if (HasSameSizeAsPartner()) {
+        return ExportDataBatchImpl(I_Info, rData);
+    }
 
-    Info connect_detail_info = ConnectDetail(I_Info);
-    mIsConnected = true;
-    connect_detail_info.Set<bool>("is_connected", true);
-    connect_detail_info.Set<int>("connection_status", ConnectionStatus::Connected);
-    connect_detail_info.Set<std::string>("working_directory", mWorkingDirectory.string());
+    Info info = CreateInfoForSkippedTransfer();
+    for (const auto& r_data : rData) {
+        Info data_info(I_Info);
+        data_info.Set<std::string>("identifier", r_data.first);
+        AccumulateTransferInfo(info, ExportDataToPartnerRanks(data_info, *r_data.second));
+    }
+    return info;
 
-    CO_SIM_IO_ERROR_IF_NOT(mIsConnected) << "Connection was not successful!" << std::endl;
+    CO_SIM_IO_CATCH
+}
 
-    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Connection established" << std::endl;
+template<typename TDataType>
+Info Communication::ImportDataFromPartnerRanks(
+    const Info& I_Info,
+    Internals::DataContainer<TDataType>& rData)
+{
+    CO_SIM_IO_TRY
 
-    return connect_detail_info;
+    const DataType data_type = DataTypeTraits<TDataType>::Type();
+    CO_SIM_IO_ERROR_IF_NOT(HasSameSizeAsPartner()) << "Importing data of type \"" << DataTypeToString(data_type) << "\" is only supported if the partner runs with the same number of processes!" << std::endl;
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+    const double elapsed_time = ReceiveDataBuffers(I_Info, [&](const std::string& rHeader){
+        const std::vector<DataHeaderEntry> entries = ParseDataHeader(rHeader, {{identifier, data_type}});
+        rData.resize(entries[0].Size);
+        return std::vector<DataBufferType>{GetDataBuffer(rData)};
+    });
+
+    Info info;
+    info.Set<double>("elapsed_time", elapsed_time);
+    info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(TDataType));
+    return info;
 
     CO_SIM_IO_CATCH
 }
 
-Info Communication::Disconnect(const Info& I_Info)
+template<typename TDataType>
+Info Communication::ExportDataToPartnerRanks(
+    const Info& I_Info,
+    const Internals::DataContainer<TDataType>& rData)
 {
     CO_SIM_IO_TRY
 
-    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Disconnecting \"" << mConnectionName << "\" ..." << std::endl;
+    const DataType data_type = DataTypeTraits<TDataType>::Type();
+    CO_SIM_IO_ERROR_IF_NOT(HasSameSizeAsPartner()) << "Exporting data of type \"" << DataTypeToString(data_type) << "\" is only supported if the partner runs with the same number of processes!" << std::endl;
 
-    if (mIsConnected) {
-        Info disconnect_detail_info = DisconnectDetail(I_Info);
-        mIsConnected = false;
-        disconnect_detail_info.Set<bool>("is_connected", false);
+    const std::string header = CreateDataHeader({{I_Info.Get<std::string>("identifier"), data_type, rData.size()}});
 
-        BaseDisconnectDetail(I_Info);
+    const Tracer::Scope trace_scope(mTracer, "ipc", "phase");
+    Info info;
+    info.Set<double>("elapsed_time", SendDataBuffers(I_Info, header, {GetDataBuffer(rData)}));
+    info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(TDataType));
+    return info;
 
-        if (mIsConnected) {
-            CO_SIM_IO_INFO("CoSimIO") << "Warning: Disconnect was not successful!" << std::endl;
-            disconnect_detail_info.Set<int>("connection_status", ConnectionStatus::DisconnectionError);
-        } else {
-            CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Disconnecting successful" << std::endl;
-            disconnect_detail_info.Set<int>("connection_status", ConnectionStatus::Disconnected);
-        }
-        return disconnect_detail_info;
+    CO_SIM_IO_CATCH
+}
 
-    } else {
-        CO_SIM_IO_INFO("CoSimIO") << "Warning: Calling Disconnect but there was no active connection!" << std::endl;
-        Info disconnect_info;
-        disconnect_info.Set<bool>("is_connected", false);
-        disconnect_info.Set<int>("connection_status", ConnectionStatus::DisconnectionError);
-        return disconnect_info;
+#define CO_SIM_IO_INSTANTIATE_TYPED_DATA_EXCHANGE(TDataType)                                                                \
+    template Info Communication::ImportDataFromPartnerRanks<TDataType>(const Info&, Internals::DataContainer<TDataType>&);       \
+    template Info Communication::ExportDataToPartnerRanks<TDataType>(const Info&, const Internals::DataContainer<TDataType>&);
+
+CO_SIM_IO_INSTANTIATE_TYPED_DATA_EXCHANGE(float)
+CO_SIM_IO_INSTANTIATE_TYPED_DATA_EXCHANGE(std::int32_t)
+CO_SIM_IO_INSTANTIATE_TYPED_DATA_EXCHANGE(std::int64_t)
+CO_SIM_IO_INSTANTIATE_TYPED_DATA_EXCHANGE(std::complex<double>)
+
+#undef CO_SIM_IO_INSTANTIATE_TYPED_DATA_EXCHANGE
+
+Info Communication::ImportMeshFromPartnerRanks(
+    const Info& I_Info,
+    ModelPart& O_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    if (HasSameSizeAsPartner() || !Utilities::ComputePartnerRanksAsImporter(mpDataComm->Rank(), mpDataComm->Size(), mPartnerSize).empty()) {
+        return ImportMeshCached(I_Info, O_ModelPart);
     }
 
+    // no partner rank sends a mesh to this rank
+    O_ModelPart.Clear();
+    return CreateInfoForSkippedTransfer();
+
     CO_SIM_IO_CATCH
 }
 
-void Communication::BaseConnectDetail(const Info& I_Info)
+Info Communication::ExportMeshToPartnerRanks(
+    const Info& I_Info,
+    const ModelPart& I_ModelPart)
 {
     CO_SIM_IO_TRY
 
-    if (mCommInFolder && GetIsPrimaryConnection() && mpDataComm->Rank() == 0) {
-        // delete and recreate directory to remove potential leftovers
-        std::error_code ec;
-        fs::remove_all(mCommFolder, ec);
-        CO_SIM_IO_INFO_IF("CoSimIO", ec) << "Warning, communication directory (" << mCommFolder << ") could not be deleted!\nError code: " << ec.message() << std::endl;
-        if (!fs::exists(mCommFolder)) {
-            fs::create_directory(mCommFolder);
-            AddFilePermissions(mCommFolder); // otherwise the process with lower rights cannot delete files in it
+    if (HasSameSizeAsPartner()) {
+        return ExportMeshCached(I_Info, I_ModelPart);
+    }
+
+    const int my_rank = mpDataComm->Rank();
+    const std::vector<int> ranks_to_collect_from = GetRanksToCollectFrom();
+
+    // same order of communication as for the data
+    std::vector<std::unique_ptr<ModelPart>> received_model_parts;
+    std::vector<const ModelPart*> collected_model_parts;
+    for (const int rank : ranks_to_collect_from) {
+        if (rank == my_rank) {
+            collected_model_parts.push_back(&I_ModelPart);
+        } else {
+            received_model_parts.emplace_back(CoSimIO::make_unique<ModelPart>(I_ModelPart.Name()));
+            mpDataComm->Recv(*received_model_parts.back(), rank);
+            collected_model_parts.push_back(received_model_parts.back().get());
         }
     }
 
-    SynchronizeAll("conn");
+    const int rank_to_collect_on = GetRankToCollectOn();
+    if (rank_to_collect_on != my_rank) {
+        mpDataComm->Send(I_ModelPart, rank_to_collect_on);
+    }
+
+    if (collected_model_parts.empty()) {
+        return CreateInfoForSkippedTransfer();
+    } else if (collected_model_parts.size() == 1 && collected_model_parts[0] == &I_ModelPart && mpDataComm->Size() < mPartnerSize) {
+        // the partition indices of the ghost nodes are valid also for the partner
+        return ExportMeshCached(I_Info, I_ModelPart);
+    } else {
+        ModelPart merged_model_part(I_ModelPart.Name());
+        MergeModelParts(collected_model_parts, my_rank, mpDataComm->Size(), mPartnerSize, merged_model_part);
+        return ExportMeshCached(I_Info, merged_model_part);
+    }
 
     CO_SIM_IO_CATCH
 }
 
-void Communication::BaseDisconnectDetail(const Info& I_Info)
+std::vector<int> Communication::GetRanksToCollectFrom() const
 {
     CO_SIM_IO_TRY
 
-    SynchronizeAll("disconn");
+    std::vector<int> ranks;
 
-    if (mCommInFolder && GetIsPrimaryConnection() && mpDataComm->Rank() == 0) {
-        // delete directory to remove potential leftovers
-        std::error_code ec;
-        fs::remove_all(mCommFolder, ec);
-        if (ec) {
-            CO_SIM_IO_INFO("CoSimIO") << "Warning, communication directory (" << mCommFolder << ") could not be deleted!\nError code: " << ec.message() << std::endl;
+    // only the ranks that have a partner rank can export, the data of the
+    // other ranks is collected on them (same distribution as when importing)
+    if (HasPartnerRank()) {
+        for (const std::size_t rank : Utilities::ComputePartnerRanksAsImporter(mpDataComm->Rank(), mPartnerSize, mpDataComm->Size())) {
+            ranks.push_back(static_cast<int>(rank));
         }
     }
 
+    return ranks;
+
     CO_SIM_IO_CATCH
 }
 
-Info Communication::ImportInfoImpl(const Info& I_Info)
+int Communication::GetRankToCollectOn() const
 {
     CO_SIM_IO_TRY
 
-    Info imported_info;
-    Info rec_info = ReceiveObjectWithStreamSerializer(I_Info, imported_info);
-    imported_info.Set<double>("elapsed_time", rec_info.Get<double>("elapsed_time"));
-    imported_info.Set<double>("elapsed_time_ipc", rec_info.Get<double>("elapsed_time_ipc"));
-    imported_info.Set<double>("elapsed_time_serializer", rec_info.Get<double>("elapsed_time_serializer"));
-    imported_info.Set<std::size_t>("memory_usage_ipc", rec_info.Get<std::size_t>("memory_usage_ipc"));
-    return imported_info;
+    return static_cast<int>(*Utilities::ComputePartnerRanksAsExporter(mpDataComm->Rank(), mpDataComm->Size(), mPartnerSize).begin());
 
     CO_SIM_IO_CATCH
 }
 
-Info Communication::ExportInfoImpl(const Info& I_Info)
+std::future<Info> Communication::ImportDataAsync(
+    const Info& I_Info,
+    std::shared_ptr<Internals::DataContainer<double>> pData)
 {
     CO_SIM_IO_TRY
 
-    return SendObjectWithStreamSerializer(I_Info, I_Info);
+    CheckConnection(I_Info, false);
+    CheckAsyncIsPossible();
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Data \"" << I_Info.Get<std::string>("identifier") << "\" asynchronously ..." << std::endl;
+
+    return ImportDataAsyncImpl(I_Info, pData);
 
     CO_SIM_IO_CATCH
 }
 
-Info Communication::ImportDataImpl(
+std::future<Info> Communication::ExportDataAsync(
     const Info& I_Info,
-    Internals::DataContainer<double>& rData)
+    std::shared_ptr<const Internals::DataContainer<double>> pData)
 {
     CO_SIM_IO_TRY
 
-    if (mAlwaysUseSerializer) {
-        return ReceiveObjectWithStreamSerializer(I_Info, rData);
-    } else {
-        Info info;
-        const double elapsed_time = ReceiveDataContainer(I_Info, rData);
-        info.Set<double>("elapsed_time", elapsed_time);
-        info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(double));
-        return info;
-    }
+    CheckConnection(I_Info, false);
+    CheckAsyncIsPossible();
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Data \"" << I_Info.Get<std::string>("identifier") << "\" asynchronously ..." << std::endl;
+
+    return ExportDataAsyncImpl(I_Info, pData);
 
     CO_SIM_IO_CATCH
 }
 
-Info Communication::ExportDataImpl(
+std::future<Info> Communication::ImportDataAsyncImpl(
     const Info& I_Info,
-    const Internals::DataContainer<double>& rData)
+    std::shared_ptr<Internals::DataContainer<double>> pData)
 {
     CO_SIM_IO_TRY
 
-    if (mAlwaysUseSerializer) {
-        return SendObjectWithStreamSerializer(I_Info, rData);
-    } else {
-        Info info;
-        const double elapsed_time = SendDataContainer(I_Info, rData);
-        info.Set<double>("elapsed_time", elapsed_time);
-        info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(double));
-        return info;
-    }
+    return EnqueueAsyncOperation([this, I_Info, pData](){
+        const Tracer::Scope trace_scope(mTracer, "import_data_async", "operation", I_Info.Get<std::string>("identifier"));
+        Info o_info = ImportDataFromPartnerRanks(I_Info, *pData);
+        PostChecks(o_info);
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Data " << I_Info.Get<std::string>("identifier") << "\" asynchronously" << std::endl;
+        RecordElapsedTime(I_Info, o_info, "Import data (async)");
+        return o_info;
+    });
 
     CO_SIM_IO_CATCH
 }
 
-Info Communication::ImportMeshImpl(
+std::future<Info> Communication::ExportDataAsyncImpl(
     const Info& I_Info,
-    ModelPart& O_ModelPart)
+    std::shared_ptr<const Internals::DataContainer<double>> pData)
 {
     CO_SIM_IO_TRY
 
-    return ReceiveObjectWithStreamSerializer(I_Info, O_ModelPart);
+    return EnqueueExportDataAsync(I_Info, [this, I_Info, pData](){
+        return ExportDataToPartnerRanks(I_Info, *pData);
+    });
 
     CO_SIM_IO_CATCH
 }
 
-Info Communication::ExportMeshImpl(
+std::future<Info> Communication::EnqueueExportDataAsync(
     const Info& I_Info,
-    const ModelPart& I_ModelPart)
+    std::function<Info()> Export)
 {
     CO_SIM_IO_TRY
 
-    return SendObjectWithStreamSerializer(I_Info, I_ModelPart);
+    return EnqueueAsyncOperation([this, I_Info, Export](){
+        const Tracer::Scope trace_scope(mTracer, "export_data_async", "operation", I_Info.Get<std::string>("identifier"));
+        Info o_info = Export();
+        PostChecks(o_info);
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Data " << I_Info.Get<std::string>("identifier") << "\" asynchronously" << std::endl;
+        RecordElapsedTime(I_Info, o_info, "Export data (async)");
+        return o_info;
+    });
+
+    CO_SIM_IO_CATCH
+}
+
+std::future<Info> Communication::EnqueueAsyncOperation(std::function<Info()> Operation)
+{
+    CO_SIM_IO_TRY
+
+    // std::function requires copyable objects, hence the (move-only) task is wrapped in a shared_ptr
+    auto p_task = std::make_shared<std::packaged_task<Info()>>(std::move(Operation));
+    std::future<Info> future = p_task->get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mAsyncMutex);
+        if (!mAsyncThread.joinable()) { // thread is only started when it is needed
+            mStopAsyncThread = false;
+            mAsyncThread = std::thread(&Communication::AsyncThreadLoop, this);
+        }
+        mAsyncTasks.push_back([p_task](){(*p_task)();});
+        ++mNumPendingAsyncOperations;
+    }
+    mAsyncTaskAvailable.notify_one();
+
+    return future;
 
     CO_SIM_IO_CATCH
 }
 
-void Communication::CheckConnection(const Info& I_Info)
+void Communication::WaitForAsyncOperations()
+{
+    std::unique_lock<std::mutex> lock(mAsyncMutex);
+    mAsyncTasksFinished.wait(lock, [this](){return mNumPendingAsyncOperations == 0;});
+}
+
+void Communication::AsyncThreadLoop()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mAsyncMutex);
+            mAsyncTaskAvailable.wait(lock, [this](){return mStopAsyncThread || !mAsyncTasks.empty();});
+            if (mAsyncTasks.empty()) {return;} // only stopping once all tasks are completed
+            task = std::move(mAsyncTasks.front());
+            mAsyncTasks.pop_front();
+        }
+
+        task(); // exceptions are stored in the future
+
+        {
+            std::lock_guard<std::mutex> lock(mAsyncMutex);
+            --mNumPendingAsyncOperations;
+        }
+        mAsyncTasksFinished.notify_all();
+    }
+}
+
+void Communication::StopAsyncThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(mAsyncMutex);
+        mStopAsyncThread = true;
+    }
+    mAsyncTaskAvailable.notify_one();
+
+    if (mAsyncThread.joinable()) {
+        mAsyncThread.join();
+    }
+}
+
+void Communication::CheckConnection(const Info& I_Info, const bool WaitForAsync)
 {
     CO_SIM_IO_ERROR_IF_NOT(mIsConnected) << "No active connection exists!" << std::endl;
     CO_SIM_IO_ERROR_IF_NOT(I_Info.Has("identifier")) << "\"identifier\" must be specified!" << std::endl;
-    Utilities::CheckEntry(I_Info.Get<std::string>("identifier"), "identifier");
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+    Utilities::CheckEntry(identifier, "identifier");
+    CO_SIM_IO_ERROR_IF(identifier.size() >= MESH_UPDATE_SUFFIX.size() && identifier.compare(identifier.size()-MESH_UPDATE_SUFFIX.size(), MESH_UPDATE_SUFFIX.size(), MESH_UPDATE_SUFFIX) == 0) << "Identifiers must not end with \"" << MESH_UPDATE_SUFFIX << "\", it is reserved for internal use! Identifier: \"" << identifier << "\"" << std::endl;
+
+    // preserving the order of operations
+    if (WaitForAsync) {WaitForAsyncOperations();}
+}
+
+void Communication::CheckAsyncIsPossible() const
+{
+    // the background thread calls MPI (e.g. for the M:N redistribution) while the main thread might do so as well
+    CO_SIM_IO_ERROR_IF_NOT(mpDataComm->IsThreadSafe()) << "Asynchronous operations require MPI to be initialized with MPI_THREAD_MULTIPLE!" << std::endl;
 }
 
 void Communication::PostChecks(const Info& I_Info)
@@ -354,9 +1542,7 @@ void Communication::WaitUntilFileIsRemoved(
     std::error_code ec;
     if (fs::exists(rPath, ec)) { // only issue the wating message if the file exists initially
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>=PrintEchoLevel) << "Waiting for: " << rPath << " to be removed" << std::endl;
-        while(fs::exists(rPath, ec)) {
-            std::this_thread::sleep_for(std::chrono::microseconds(10)); // wait 0.001s before next check
-        }
+        Utilities::WaitUntilPathIsRemoved(rPath);
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>=PrintEchoLevel) << rPath << " was removed" << std::endl;
     }
 
@@ -407,6 +1593,8 @@ void Communication::SynchronizeAll(const std::string& rTag) const
 {
     CO_SIM_IO_TRY
 
+    const Tracer::Scope trace_scope(mTracer, "synchronize_all", "connection", rTag);
+
     // first synchronize among the partitions
     mpDataComm->Barrier();
 
@@ -463,7 +1651,10 @@ Info Communication::GetMyInfo() const
     my_info.Set<bool>("is_big_endian", Utilities::IsBigEndian());
 
     my_info.Set<bool>("always_use_serializer", mAlwaysUseSerializer);
+    my_info.Set<bool>("use_incremental_mesh_export", mUseIncrementalMeshExport);
+    my_info.Set<bool>("use_mesh_cache", mUseMeshCache);
     my_info.Set<std::string>("serializer_trace_type", Serializer::TraceTypeToString(mSerializerTraceType));
+    my_info.Set<std::string>("compression", Compression::CompressionTypeToString(mCompression));
 
     my_info.Set<Info>("communication_settings", GetCommunicationSettings());
 
@@ -474,6 +1665,8 @@ void Communication::HandShake(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    const Tracer::Scope trace_scope(mTracer, "handshake", "connection");
+
     if (mpDataComm->Rank() == 0) {
         const fs::path file_name_p2s(GetFileName("CoSimIO_" + GetConnectionName() + "_compatibility_check_primary_to_secondary", "dat"));
         const fs::path file_name_s2p(GetFileName("CoSimIO_" + GetConnectionName() + "_compatibility_check_secondary_to_primary", "dat"));
@@ -516,12 +1709,18 @@ void Communication::HandShake(const Info& I_Info)
 
         CO_SIM_IO_ERROR_IF(GetCommunicationName() != mPartnerInfo.Get<std::string>("communication_format")) << "Mismatch in communication_format!\nMy communication_format: " << GetCommunicationName() << "\nPartner communication_format: " << mPartnerInfo.Get<std::string>("communication_format") << std::endl;
 
-        CO_SIM_IO_ERROR_IF(GetDataCommunicator().Size() != mPartnerInfo.Get<int>("num_processes")) << "Mismatch in num_processes!\nMy num_processes: " << GetDataCommunicator().Size() << "\nPartner num_processes: " << mPartnerInfo.Get<int>("num_processes") << std::endl;
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && GetDataCommunicator().Size() != mPartnerInfo.Get<int>("num_processes")) << "Partner uses a different number of processes, data is redistributed among the ranks\n    My num_processes:      " << GetDataCommunicator().Size() << "\n    Partner num_processes: " << mPartnerInfo.Get<int>("num_processes") << std::endl;
 
         CO_SIM_IO_ERROR_IF(mAlwaysUseSerializer != mPartnerInfo.Get<bool>("always_use_serializer")) << std::boolalpha << "Mismatch in always_use_serializer!\nMy always_use_serializer: " << mAlwaysUseSerializer << "\nPartner always_use_serializer: " << mPartnerInfo.Get<bool>("always_use_serializer") << std::noboolalpha << std::endl;
 
+        CO_SIM_IO_ERROR_IF(mUseIncrementalMeshExport != mPartnerInfo.Get<bool>("use_incremental_mesh_export")) << std::boolalpha << "Mismatch in use_incremental_mesh_export!\nMy use_incremental_mesh_export: " << mUseIncrementalMeshExport << "\nPartner use_incremental_mesh_export: " << mPartnerInfo.Get<bool>("use_incremental_mesh_export") << std::noboolalpha << std::endl;
+
+        CO_SIM_IO_ERROR_IF(mUseMeshCache != mPartnerInfo.Get<bool>("use_mesh_cache")) << std::boolalpha << "Mismatch in use_mesh_cache!\nMy use_mesh_cache: " << mUseMeshCache << "\nPartner use_mesh_cache: " << mPartnerInfo.Get<bool>("use_mesh_cache") << std::noboolalpha << std::endl;
+
         CO_SIM_IO_ERROR_IF(Serializer::TraceTypeToString(mSerializerTraceType) != mPartnerInfo.Get<std::string>("serializer_trace_type")) << "Mismatch in serializer_trace_type!\nMy serializer_trace_type: " << Serializer::TraceTypeToString(mSerializerTraceType) << "\nPartner serializer_trace_type: " << mPartnerInfo.Get<std::string>("serializer_trace_type") << std::endl;
 
+        CO_SIM_IO_ERROR_IF(Compression::CompressionTypeToString(mCompression) != mPartnerInfo.Get<std::string>("compression")) << "Mismatch in compression!\nMy compression: " << Compression::CompressionTypeToString(mCompression) << "\nPartner compression: " << mPartnerInfo.Get<std::string>("compression") << std::endl;
+
         auto print_endianness = [](const bool IsBigEndian){return IsBigEndian ? "big endian" : "small endian";};
 
         CO_SIM_IO_INFO_IF("CoSimIO", Utilities::IsBigEndian() != mPartnerInfo.Get<bool>("is_big_endian")) << "WARNING: Parnters have different endianness, check results carefully! It is recommended to use serialized ascii communication.\n    My endianness:      " << print_endianness(Utilities::IsBigEndian()) << "\n    Partner endianness: " << print_endianness(mPartnerInfo.Get<bool>("is_big_endian")) << std::endl;
@@ -533,10 +1732,39 @@ void Communication::HandShake(const Info& I_Info)
     // sync the partner info among the partitions
     mpDataComm->Broadcast(mPartnerInfo, 0);
 
+    mPartnerSize = mPartnerInfo.Get<int>("num_processes");
+
+    CO_SIM_IO_CATCH
+}
+
+void Communication::WriteTrace() const
+{
+    CO_SIM_IO_TRY
+
+    if (!mTracer.IsEnabled()) {return;}
+
+    const std::string events = mTracer.GetEventsJson(mpDataComm->Rank());
+
+    if (mpDataComm->Rank() == 0) {
+        std::vector<std::string> events_of_ranks {events};
+        for (int i=1; i<mpDataComm->Size(); ++i) {
+            std::string events_of_rank;
+            mpDataComm->Recv(events_of_rank, i);
+            events_of_ranks.push_back(std::move(events_of_rank));
+        }
+
+        const fs::path trace_file = mWorkingDirectory / mTraceFile; // does nothing if mTraceFile is an absolute path
+        mTracer.WriteChromeTrace(trace_file, events_of_ranks);
+
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0) << "Trace of \"" << mConnectionName << "\" was written to " << trace_file << std::endl;
+    } else {
+        mpDataComm->Send(events, 0);
+    }
+
     CO_SIM_IO_CATCH
 }
 
-void Communication::PrintElapsedTime(
+void Communication::RecordElapsedTime(
     const Info& I_Info,
     const Info& O_Info,
     const std::string& rLabel)
@@ -544,6 +1772,14 @@ void Communication::PrintElapsedTime(
     const std::string identifier =I_Info.Get<std::string>("identifier");
     const double dur = O_Info.Get<double>("elapsed_time");
     CO_SIM_IO_INFO_IF("CoSimIO-Timing", GetPrintTiming() && GetDataCommunicator().Rank()==0) << rLabel << " \"" << identifier << "\" took " << dur << " [s]" << std::endl;
+
+    // "Import data (async)" => "import_data_async"
+    std::string operation;
+    for (const char c : rLabel) {
+        if (c == ' ') {operation += '_';}
+        else if (c != '(' && c != ')') {operation += static_cast<char>(std::tolower(c));}
+    }
+    mStatistics.Record(operation, identifier, O_Info);
 }
 
 } // namespace Internals
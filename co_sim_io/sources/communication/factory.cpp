@@ -17,6 +17,7 @@
 
 #include "includes/communication/file_communication.hpp"
 #include "includes/communication/pipe_communication.hpp"
+#include "includes/communication/shared_memory_communication.hpp"
 #include "includes/communication/local_socket_communication.hpp"
 #include "includes/communication/socket_communication.hpp"
 
@@ -77,6 +78,11 @@ CommunicationFactory::CommCreateFctsType CommunicationFactory::GetCommunicationC
         const std::shared_ptr<DataCommunicator> pDataComm){
             return CoSimIO::make_unique<PipeCommunication>(I_Settings, pDataComm);};
 
+    fcts["shared_memory"] = [](
+        const Info& I_Settings,
+        const std::shared_ptr<DataCommunicator> pDataComm){
+            return CoSimIO::make_unique<SharedMemoryCommunication>(I_Settings, pDataComm);};
+
     fcts["local_socket"] = [](
         const Info& I_Settings,
         const std::shared_ptr<DataCommunicator> pDataComm){
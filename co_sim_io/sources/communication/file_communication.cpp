@@ -12,13 +12,22 @@
 
 // System includes
 #include <chrono>
+#include <cstring>
 #include <iomanip>
 
 // Project includes
+#include "includes/define.hpp" // for "CO_SIM_IO_COMPILED_IN_WINDOWS"
 #include "includes/communication/file_communication.hpp"
 #include "includes/utilities.hpp"
 #include "includes/file_serializer.hpp"
 
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
 namespace CoSimIO {
 namespace Internals {
 
@@ -54,17 +63,120 @@ void SerializeFromFile(
     CO_SIM_IO_CATCH
 }
 
-}
+// maps a data file into memory, such that it can be written and read with memcpy instead of going through the stream buffers
+// the layout of the file is the same as when using streams
+class MemoryMappedFile
+{
+public:
+    // creates the file with the given size for writing
+    MemoryMappedFile(const fs::path& rPath, const std::size_t Size)
+        : mSize(Size)
+    {
+        CO_SIM_IO_TRY
+
+        #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+        CO_SIM_IO_ERROR << "Memory mapped files are not yet implemented for Windows!" << std::endl;
+        #else
+        const int fd = open(rPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+        CO_SIM_IO_ERROR_IF(fd < 0) << rPath << " could not be opened for writing!" << std::endl;
+        if (ftruncate(fd, static_cast<off_t>(mSize)) != 0) {
+            close(fd);
+            CO_SIM_IO_ERROR << rPath << " could not be resized to " << mSize << " bytes!" << std::endl;
+        }
+        Map(fd, PROT_READ | PROT_WRITE, rPath);
+        #endif
+
+        CO_SIM_IO_CATCH
+    }
+
+    // opens an existing file for reading
+    explicit MemoryMappedFile(const fs::path& rPath)
+    {
+        CO_SIM_IO_TRY
+
+        #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+        CO_SIM_IO_ERROR << "Memory mapped files are not yet implemented for Windows!" << std::endl;
+        #else
+        const int fd = open(rPath.c_str(), O_RDONLY);
+        CO_SIM_IO_ERROR_IF(fd < 0) << rPath << " could not be opened for reading!" << std::endl;
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            CO_SIM_IO_ERROR << "Size of " << rPath << " could not be determined!" << std::endl;
+        }
+        mSize = static_cast<std::size_t>(file_stat.st_size);
+        Map(fd, PROT_READ, rPath);
+        #endif
+
+        CO_SIM_IO_CATCH
+    }
+
+    ~MemoryMappedFile()
+    {
+        #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+        if (mpData) {
+            munmap(mpData, mSize);
+        }
+        #endif
+    }
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    std::size_t size() const {return mSize;}
+
+    // appends data when writing
+    void Write(const void* pSource, const std::size_t Size)
+    {
+        CO_SIM_IO_ERROR_IF(mPosition+Size > mSize) << "Writing " << Size << " bytes exceeds the size of the mapped file (" << mSize << " bytes)!" << std::endl;
+        if (Size > 0) {
+            std::memcpy(mpData+mPosition, pSource, Size);
+            mPosition += Size;
+        }
+    }
+
+    // reads the next data
+    void Read(void* pDestination, const std::size_t Size)
+    {
+        CO_SIM_IO_ERROR_IF(mPosition+Size > mSize) << "Reading " << Size << " bytes exceeds the size of the mapped file (" << mSize << " bytes)!" << std::endl;
+        if (Size > 0) {
+            std::memcpy(pDestination, mpData+mPosition, Size);
+            mPosition += Size;
+        }
+    }
+
+    std::size_t RemainingSize() const {return mSize-mPosition;}
+
+private:
+    char* mpData = nullptr; // nullptr for empty files, as they cannot be mapped
+    std::size_t mSize = 0;
+    std::size_t mPosition = 0;
+
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    void Map(const int FileDescriptor, const int Protection, const fs::path& rPath)
+    {
+        void* p_mem = (mSize > 0) ? mmap(nullptr, mSize, Protection, MAP_SHARED, FileDescriptor, 0) : nullptr;
+        close(FileDescriptor); // the mapping stays valid after closing the file descriptor
+        CO_SIM_IO_ERROR_IF(p_mem == MAP_FAILED) << rPath << " could not be mapped!" << std::endl;
+        mpData = static_cast<char*>(p_mem);
+    }
+    #endif
+};
+
+} // anonymous namespace
 
 FileCommunication::FileCommunication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
     : Communication(I_Settings, I_DataComm),
       mUseAuxFileForFileAvailability(I_Settings.Get<bool>("use_aux_file_for_file_availability", USE_AUX_FILE_FOR_FILE_AVAILABILITY)),
-      mUseFileSerializer(I_Settings.Get<bool>("use_file_serializer", true))
+      mUseFileSerializer(I_Settings.Get<bool>("use_file_serializer", true)),
+      mUseFileQueue(I_Settings.Get<bool>("use_file_queue", false)),
+      mUseMemoryMappedFiles(I_Settings.Get<bool>("use_memory_mapped_files", false))
 {
 #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
     CO_SIM_IO_INFO_IF("CoSimIO", !mUseAuxFileForFileAvailability) << "WARNING: Using rename for making files available can cause race conditions as it is not atomic in Windows! Use \"use_aux_file_for_file_availability\" = false to avoid this" << std::endl;
+    CO_SIM_IO_ERROR_IF(mUseMemoryMappedFiles) << "\"use_memory_mapped_files\" is not yet supported in Windows!" << std::endl;
 #endif
 }
 
@@ -93,6 +205,10 @@ void FileCommunication::DerivedHandShake() const
     const bool partner_use_file_serializer = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_file_serializer");
     CO_SIM_IO_ERROR_IF(my_use_file_serializer != partner_use_file_serializer) << std::boolalpha << "Mismatch in use_file_serializer!\nMy use_file_serializer: " << my_use_file_serializer << "\nPartner use_file_serializer: " << partner_use_file_serializer << std::noboolalpha << std::endl;
 
+    const bool my_use_file_queue = GetMyInfo().Get<Info>("communication_settings").Get<bool>("use_file_queue");
+    const bool partner_use_file_queue = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_file_queue");
+    CO_SIM_IO_ERROR_IF(my_use_file_queue != partner_use_file_queue) << std::boolalpha << "Mismatch in use_file_queue!\nMy use_file_queue: " << my_use_file_queue << "\nPartner use_file_queue: " << partner_use_file_queue << std::noboolalpha << std::endl;
+
     CO_SIM_IO_CATCH
 }
 
@@ -103,6 +219,7 @@ Info FileCommunication::GetCommunicationSettings() const
     Info info;
     info.Set("use_aux_file_for_file_availability", mUseAuxFileForFileAvailability);
     info.Set("use_file_serializer", mUseFileSerializer);
+    info.Set("use_file_queue", mUseFileQueue);
 
     return info;
 
@@ -199,6 +316,38 @@ Info FileCommunication::ExportMeshImpl(
     CO_SIM_IO_CATCH
 }
 
+fs::path FileCommunication::GetDataFileName(
+    const Info& I_Info,
+    std::unordered_map<std::string, std::size_t>& rCounters) const
+{
+    CO_SIM_IO_TRY
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    std::string file_name("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()));
+
+    if (mUseFileQueue) {
+        // every file gets a sequence number, this way the sender does not have to wait until the partner has read the previous file
+        // the order is preserved since both partners count the transfers per identifier
+        file_name += "_" + std::to_string(rCounters[identifier]++);
+    }
+
+    return GetFileName(file_name, "dat");
+
+    CO_SIM_IO_CATCH
+}
+
+void FileCommunication::WaitForPreviousSend(const fs::path& rPath) const
+{
+    CO_SIM_IO_TRY
+
+    if (!mUseFileQueue) {
+        WaitUntilFileIsRemoved(rPath);
+    }
+
+    CO_SIM_IO_CATCH
+}
+
 template<class TObjectType>
 Info FileCommunication::GenericSendWithFileSerializer(
     const Info& I_Info,
@@ -208,11 +357,9 @@ Info FileCommunication::GenericSendWithFileSerializer(
 
     Info info;
 
-    const std::string identifier = I_Info.Get<std::string>("identifier");
+    const fs::path file_name(GetDataFileName(I_Info, mSendCounters));
 
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
-
-    WaitUntilFileIsRemoved(file_name); // TODO maybe this can be queued somehow ... => then it would not block the sender
+    WaitForPreviousSend(file_name);
 
     const auto start_time(std::chrono::steady_clock::now());
     SerializeToFile(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), rObj, GetSerializerTraceType());
@@ -237,9 +384,7 @@ Info FileCommunication::GenericReceiveWithFileSerializer(
 
     Info info;
 
-    const std::string identifier = I_Info.Get<std::string>("identifier");
-
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
+    const fs::path file_name(GetDataFileName(I_Info, mReceiveCounters));
 
     WaitForPath(file_name, mUseAuxFileForFileAvailability);
 
@@ -265,24 +410,29 @@ double FileCommunication::GenericSend(
 {
     CO_SIM_IO_TRY
 
-    const std::string identifier = I_Info.Get<std::string>("identifier");
-
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
+    const fs::path file_name(GetDataFileName(I_Info, mSendCounters));
 
-    WaitUntilFileIsRemoved(file_name); // TODO maybe this can be queued somehow ... => then it would not block the sender
+    WaitForPreviousSend(file_name);
 
     const std::size_t size = rData.size();
 
     const auto start_time(std::chrono::steady_clock::now());
 
-    std::ofstream output_file(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), std::ios::out|std::ios::binary);
-    Utilities::CheckStream(output_file, file_name);
+    if (mUseMemoryMappedFiles) {
+        MemoryMappedFile mapped_file(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), sizeof(std::size_t) + size*SizeOfData);
+        mapped_file.Write(&size, sizeof(std::size_t));
+        mapped_file.Write(rData.data(), size*SizeOfData);
+    } else {
+        std::ofstream output_file(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), std::ios::out|std::ios::binary);
+        Utilities::CheckStream(output_file, file_name);
+
+        output_file.write(reinterpret_cast<const char *>(&size), sizeof(std::size_t));
 
-    output_file.write(reinterpret_cast<const char *>(&size), sizeof(std::size_t));
+        output_file.write(reinterpret_cast<const char *>(&rData[0]), rData.size()*SizeOfData);
 
-    output_file.write(reinterpret_cast<const char *>(&rData[0]), rData.size()*SizeOfData);
+        output_file.close();
+    }
 
-    output_file.close();
     MakeFileVisible(file_name, mUseAuxFileForFileAvailability);
 
     return Utilities::ElapsedSeconds(start_time);
@@ -298,24 +448,36 @@ double FileCommunication::GenericReceive(
 {
     CO_SIM_IO_TRY
 
-    const std::string identifier = I_Info.Get<std::string>("identifier");
-
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
+    const fs::path file_name(GetDataFileName(I_Info, mReceiveCounters));
 
     WaitForPath(file_name, mUseAuxFileForFileAvailability);
 
     const auto start_time(std::chrono::steady_clock::now());
 
-    std::ifstream input_file(file_name, std::ios::binary|std::ios::in);
-    Utilities::CheckStream(input_file, file_name);
+    if (mUseMemoryMappedFiles) {
+        MemoryMappedFile mapped_file(file_name);
 
-    std::size_t size_read;
-    input_file.read((char*)&size_read, sizeof(std::size_t));
+        std::size_t size_read;
+        mapped_file.Read(&size_read, sizeof(std::size_t));
+        CO_SIM_IO_ERROR_IF(mapped_file.RemainingSize() != size_read*SizeOfData) << "Size of " << file_name << " does not match the size of the data!" << std::endl;
 
-    rData.resize(size_read);
-    input_file.read((char*)&rData[0], size_read*SizeOfData);
+        rData.resize(size_read);
+        if (size_read > 0) {
+            mapped_file.Read(&rData[0], size_read*SizeOfData);
+        }
+    } else {
+        std::ifstream input_file(file_name, std::ios::binary|std::ios::in);
+        Utilities::CheckStream(input_file, file_name);
+
+        std::size_t size_read;
+        input_file.read((char*)&size_read, sizeof(std::size_t));
+
+        rData.resize(size_read);
+        input_file.read((char*)&rData[0], size_read*SizeOfData);
+
+        input_file.close();
+    }
 
-    input_file.close();
     RemovePath(file_name);
 
     return Utilities::ElapsedSeconds(start_time);
@@ -351,5 +513,103 @@ double FileCommunication::ReceiveDataContainer(
     return GenericReceive(I_Info, rData, sizeof(double));
 }
 
+double FileCommunication::SendDataBuffers(
+    const Info& I_Info,
+    const std::string& rHeader,
+    const std::vector<ConstDataBufferType>& rBuffers)
+{
+    CO_SIM_IO_TRY
+
+    // header and data are written to one file
+    const fs::path file_name(GetDataFileName(I_Info, mSendCounters));
+
+    WaitForPreviousSend(file_name);
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    const std::size_t header_size = rHeader.size();
+
+    if (mUseMemoryMappedFiles) {
+        std::size_t total_size = sizeof(std::size_t) + header_size;
+        for (const auto& r_buffer : rBuffers) {
+            total_size += r_buffer.second;
+        }
+
+        MemoryMappedFile mapped_file(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), total_size);
+        mapped_file.Write(&header_size, sizeof(std::size_t));
+        mapped_file.Write(rHeader.data(), header_size);
+
+        for (const auto& r_buffer : rBuffers) {
+            mapped_file.Write(r_buffer.first, r_buffer.second);
+        }
+    } else {
+        std::ofstream output_file(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), std::ios::out|std::ios::binary);
+        Utilities::CheckStream(output_file, file_name);
+
+        output_file.write(reinterpret_cast<const char *>(&header_size), sizeof(std::size_t));
+        output_file.write(rHeader.data(), header_size);
+
+        for (const auto& r_buffer : rBuffers) {
+            output_file.write(r_buffer.first, r_buffer.second);
+        }
+
+        output_file.close();
+    }
+
+    MakeFileVisible(file_name, mUseAuxFileForFileAvailability);
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+double FileCommunication::ReceiveDataBuffers(
+    const Info& I_Info,
+    const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived)
+{
+    CO_SIM_IO_TRY
+
+    const fs::path file_name(GetDataFileName(I_Info, mReceiveCounters));
+
+    WaitForPath(file_name, mUseAuxFileForFileAvailability);
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    if (mUseMemoryMappedFiles) {
+        MemoryMappedFile mapped_file(file_name);
+
+        std::size_t header_size;
+        mapped_file.Read(&header_size, sizeof(std::size_t));
+
+        std::string header(header_size, ' ');
+        mapped_file.Read(&header[0], header_size);
+
+        for (const auto& r_buffer : rHeaderReceived(header)) {
+            mapped_file.Read(r_buffer.first, r_buffer.second);
+        }
+    } else {
+        std::ifstream input_file(file_name, std::ios::binary|std::ios::in);
+        Utilities::CheckStream(input_file, file_name);
+
+        std::size_t header_size;
+        input_file.read((char*)&header_size, sizeof(std::size_t));
+
+        std::string header(header_size, ' ');
+        input_file.read(&header[0], header_size);
+
+        for (const auto& r_buffer : rHeaderReceived(header)) {
+            input_file.read(r_buffer.first, r_buffer.second);
+        }
+
+        input_file.close();
+    }
+
+    RemovePath(file_name);
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
 } // namespace Internals
 } // namespace CoSimIO
@@ -26,11 +26,14 @@ Info LocalSocketCommunication::ConnectDetail(const Info& I_Info)
     CO_SIM_IO_INFO_IF("CoSimIO", GetDataCommunicator().IsDistributed() && GetDataCommunicator().Rank()==0) << "Warning: Connection was done with MPI, but local-socket based communication works only within the same machine. Communicating between different compute nodes in a distributed memory machine when does not work, it will hang!" << std::endl;
 
     using asio::local::stream_protocol;
-    mpAsioSocket = std::make_shared<stream_protocol::socket>(mAsioContext);
+    if (HasPartnerRank()) {
+        mpAsioSocket = std::make_shared<stream_protocol::socket>(mAsioContext);
+    }
 
-    const std::string bind_file_name = fs::path(GetCommunicationDirectory() / "socket_bind").string();
+    const std::string bind_file_name = fs::path(GetCommunicationDirectory() / ("socket_bind_r" + std::to_string(GetDataCommunicator().Rank()))).string();
 
-    if (GetIsPrimaryConnection()) { // this is the server
+    // the synchronization is also done by the ranks without partner rank as it is collective
+    if (GetIsPrimaryConnection() && HasPartnerRank()) { // this is the server
         std::ofstream bind_file;
         bind_file.open(bind_file_name);
         bind_file.close();
@@ -45,7 +48,9 @@ Info LocalSocketCommunication::ConnectDetail(const Info& I_Info)
 
     stream_protocol::endpoint this_endpoint(bind_file_name.c_str());
 
-    if (GetIsPrimaryConnection()) { // this is the server
+    if (!HasPartnerRank()) {
+        SynchronizeAll("local_sock_2");
+    } else if (GetIsPrimaryConnection()) { // this is the server
         mpAsioAcceptor = std::make_shared<stream_protocol::acceptor>(mAsioContext, this_endpoint);
         SynchronizeAll("local_sock_2");
         mpAsioAcceptor->accept(*mpAsioSocket);
@@ -13,12 +13,17 @@
 // System includes
 #include "includes/define.hpp" // for "CO_SIM_IO_COMPILED_IN_WINDOWS"
 
+#include <algorithm>
+#include <cerrno>
+
 #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
 
 #else
+    #include <climits>
     #include <fcntl.h>
     #include <sys/stat.h>
     #include <sys/types.h>
+    #include <sys/uio.h>
     #include <unistd.h>
 #endif
 
@@ -45,13 +50,88 @@ int GetPipeBufferSize(const Info& I_Info)
     return I_Info.Get<int>("buffer_size", default_buffer_size);
 }
 
+bool GetUseVmsplice(const Info& I_Info)
+{
+    const bool use_vmsplice = I_Info.Get<bool>("use_vmsplice", false);
+
+    #ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    return use_vmsplice;
+    #else
+    CO_SIM_IO_INFO_IF("CoSimIO", use_vmsplice) << "Warning: vmsplice is only available in Linux, the data is copied into the pipe instead!" << std::endl;
+    return false;
+    #endif
+}
+
+// for smaller messages waiting for the acknowledgement takes longer than copying the data
+constexpr std::size_t VMSPLICE_MIN_SIZE = 65536;
+
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+
+#ifdef IOV_MAX
+constexpr std::size_t MAX_IO_VECTORS = IOV_MAX;
+#else
+constexpr std::size_t MAX_IO_VECTORS = 1024;
+#endif
+
+// calls readv/writev until all buffers are transferred, as they can transfer less than requested
+// at most MaxSize bytes are transferred per call
+template<class TFunctionType>
+void TransferBuffers(
+    const std::vector<std::pair<char*, std::size_t>>& rBuffers,
+    const std::size_t MaxSize,
+    TFunctionType&& rTransferFunction)
+{
+    std::vector<iovec> io_vectors;
+    std::size_t index = 0;  // current buffer
+    std::size_t offset = 0; // already transferred bytes of the current buffer
+
+    while (true) {
+        while (index < rBuffers.size() && offset == rBuffers[index].second) {
+            ++index;
+            offset = 0;
+        }
+        if (index == rBuffers.size()) {break;}
+
+        io_vectors.clear();
+        std::size_t total_size = 0;
+        for (std::size_t i=index; i<rBuffers.size() && total_size<MaxSize && io_vectors.size()<MAX_IO_VECTORS; ++i) {
+            const std::size_t buffer_offset = (i==index) ? offset : 0;
+            const std::size_t size = std::min(rBuffers[i].second - buffer_offset, MaxSize - total_size);
+            if (size > 0) {
+                iovec io_vector;
+                io_vector.iov_base = rBuffers[i].first + buffer_offset;
+                io_vector.iov_len = size;
+                io_vectors.push_back(io_vector);
+                total_size += size;
+            }
+        }
+
+        std::size_t transferred_size = rTransferFunction(io_vectors.data(), static_cast<int>(io_vectors.size()));
+
+        while (transferred_size > 0) {
+            const std::size_t remaining_size = rBuffers[index].second - offset;
+            if (transferred_size >= remaining_size) {
+                transferred_size -= remaining_size;
+                ++index;
+                offset = 0;
+            } else {
+                offset += transferred_size;
+                transferred_size = 0;
+            }
+        }
+    }
+}
+
+#endif
+
 } // anonymous namespace
 
 PipeCommunication::PipeCommunication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
     : Communication(I_Settings, I_DataComm),
-      mBufferSize(GetPipeBufferSize(I_Settings))
+      mBufferSize(GetPipeBufferSize(I_Settings)),
+      mUseVmsplice(GetUseVmsplice(I_Settings))
 {
 }
 
@@ -70,21 +150,33 @@ Info PipeCommunication::ConnectDetail(const Info& I_Info)
 
     CO_SIM_IO_INFO_IF("CoSimIO", GetDataCommunicator().IsDistributed() && GetDataCommunicator().Rank()==0) << "Warning: Connection was done with MPI, but pipe based communication works only within the same machine. Communicating between different compute nodes in a distributed memory machine when does not work, it will hang!" << std::endl;
 
-    mpPipe = std::make_shared<BidirectionalPipe>(
-        GetCommunicationDirectory(),
-        GetConnectionName() + "_r" + std::to_string(GetDataCommunicator().Rank()),
-        GetIsPrimaryConnection(),
-        GetPipeBufferSize(I_Info),
-        GetEchoLevel());
+    // vmsplice changes the protocol (acknowledgement of large messages), hence it is only used if both partners can use it
+    const bool use_vmsplice = mUseVmsplice && GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_vmsplice");
+    CO_SIM_IO_INFO_IF("CoSimIO", mUseVmsplice && !use_vmsplice && GetEchoLevel()>0 && GetDataCommunicator().Rank()==0) << "Partner does not use vmsplice, the data is copied into the pipe instead" << std::endl;
+
+    if (HasPartnerRank()) {
+        mpPipe = std::make_shared<BidirectionalPipe>(
+            GetCommunicationDirectory(),
+            GetConnectionName() + "_r" + std::to_string(GetDataCommunicator().Rank()),
+            GetIsPrimaryConnection(),
+            GetPipeBufferSize(I_Info),
+            use_vmsplice,
+            GetEchoLevel());
+    }
 
-    return Info(); // TODO use
+    Info info;
+    info.Set<bool>("use_vmsplice", use_vmsplice);
+    return info;
 
     CO_SIM_IO_CATCH
 }
 
 Info PipeCommunication::DisconnectDetail(const Info& I_Info)
 {
-    mpPipe->Close();
+    if (mpPipe) {
+        mpPipe->Close();
+        mpPipe.reset();
+    }
     return Info(); // TODO use
 }
 
@@ -103,6 +195,7 @@ Info PipeCommunication::GetCommunicationSettings() const
 
     Info info;
     info.Set("buffer_size", mBufferSize);
+    info.Set("use_vmsplice", mUseVmsplice);
     return info;
 
     CO_SIM_IO_CATCH
@@ -114,9 +207,11 @@ PipeCommunication::BidirectionalPipe::BidirectionalPipe(
     const fs::path& rBasePipeName,
     const bool IsPrimary,
     const int BufferSize,
+    const bool UseVmsplice,
     const int EchoLevel) 
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
-    : mBufferSize(BufferSize)
+    : mBufferSize(BufferSize),
+      mUseVmsplice(UseVmsplice)
     #endif
 {
     mPipeNameWrite = mPipeNameRead = rPipeDir / rBasePipeName;
@@ -184,8 +279,7 @@ void PipeCommunication::BidirectionalPipe::Close()
 void PipeCommunication::BidirectionalPipe::SendSize(const std::uint64_t Size)
 {
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
-    const ssize_t bytes_written = write(mPipeHandleWrite, &Size, sizeof(Size));
-    CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe!" << std::endl;
+    WriteBytes(reinterpret_cast<const char*>(&Size), sizeof(Size));
     #endif
 }
 
@@ -193,14 +287,170 @@ std::uint64_t PipeCommunication::BidirectionalPipe::ReceiveSize()
 {
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
     std::uint64_t imp_size_u;
-    const ssize_t bytes_read = read(mPipeHandleRead, &imp_size_u, sizeof(imp_size_u));
-    CO_SIM_IO_ERROR_IF(bytes_read < 0) << "Error in reading from Pipe!" << std::endl;
+    ReadBytes(reinterpret_cast<char*>(&imp_size_u), sizeof(imp_size_u));
     return imp_size_u;
     #else
     return 0;
     #endif
 }
 
+void PipeCommunication::BidirectionalPipe::WriteBytes(const char* pData, const std::size_t Size)
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    std::size_t written_size = 0;
+    while (written_size < Size) {
+        const std::size_t current_size = std::min(Size - written_size, mBufferSize);
+        const ssize_t bytes_written = write(mPipeHandleWrite, pData + written_size, current_size);
+        if (bytes_written < 0 && errno == EINTR) {continue;}
+        CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe!" << std::endl;
+
+        written_size += static_cast<std::size_t>(bytes_written);
+    }
+    #endif
+}
+
+void PipeCommunication::BidirectionalPipe::ReadBytes(char* pData, const std::size_t Size)
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    std::size_t read_size = 0;
+    while (read_size < Size) {
+        const std::size_t current_size = std::min(Size - read_size, mBufferSize);
+        const ssize_t bytes_read = read(mPipeHandleRead, pData + read_size, current_size);
+        if (bytes_read < 0 && errno == EINTR) {continue;}
+        CO_SIM_IO_ERROR_IF(bytes_read < 0) << "Error in reading from Pipe!" << std::endl;
+        CO_SIM_IO_ERROR_IF(bytes_read == 0) << "Pipe was closed by the partner!" << std::endl;
+
+        read_size += static_cast<std::size_t>(bytes_read);
+    }
+    #endif
+}
+
+double PipeCommunication::BidirectionalPipe::WriteBatch(
+    const std::string& rHeader,
+    const std::vector<ConstDataBufferType>& rBuffers)
+{
+    CO_SIM_IO_TRY
+
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    const auto start_time(std::chrono::steady_clock::now());
+
+    // size of the header, header and data are written together
+    std::uint64_t header_size = rHeader.size();
+    std::vector<std::pair<char*, std::size_t>> buffers;
+    buffers.reserve(rBuffers.size()+2);
+    buffers.emplace_back(reinterpret_cast<char*>(&header_size), sizeof(header_size));
+    buffers.emplace_back(const_cast<char*>(rHeader.data()), rHeader.size());
+    std::size_t data_size = 0;
+    for (const auto& r_buffer : rBuffers) {
+        buffers.emplace_back(const_cast<char*>(r_buffer.first), r_buffer.second);
+        data_size += r_buffer.second;
+    }
+
+    if (UseVmsplice(data_size)) {
+        SpliceBuffers(buffers);
+        WaitForAcknowledgement();
+    } else {
+        WriteBuffers(buffers);
+    }
+
+    return Utilities::ElapsedSeconds(start_time);
+    #else
+    return 0.0;
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+double PipeCommunication::BidirectionalPipe::ReadBatch(const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived)
+{
+    CO_SIM_IO_TRY
+
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    const std::size_t header_size = ReceiveSize(); // serves also as synchronization for time measurement
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    std::string header(header_size, ' ');
+    if (header_size > 0) {
+        ReadBytes(&header[0], header_size);
+    }
+
+    const std::vector<DataBufferType> buffers = rHeaderReceived(header);
+    ReadBuffers(buffers);
+
+    std::size_t data_size = 0;
+    for (const auto& r_buffer : buffers) {
+        data_size += r_buffer.second;
+    }
+    if (UseVmsplice(data_size)) {
+        SendAcknowledgement();
+    }
+
+    return Utilities::ElapsedSeconds(start_time);
+    #else
+    return 0.0;
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+void PipeCommunication::BidirectionalPipe::WriteBuffers(const std::vector<std::pair<char*, std::size_t>>& rBuffers)
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    TransferBuffers(rBuffers, mBufferSize, [this](const iovec* pIoVectors, const int NumIoVectors) -> std::size_t {
+        ssize_t bytes_written;
+        while ((bytes_written = writev(mPipeHandleWrite, pIoVectors, NumIoVectors)) < 0 && errno == EINTR) {}
+        CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe!" << std::endl;
+        return static_cast<std::size_t>(bytes_written);
+    });
+    #endif
+}
+
+void PipeCommunication::BidirectionalPipe::ReadBuffers(const std::vector<std::pair<char*, std::size_t>>& rBuffers)
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    TransferBuffers(rBuffers, mBufferSize, [this](const iovec* pIoVectors, const int NumIoVectors) -> std::size_t {
+        ssize_t bytes_read;
+        while ((bytes_read = readv(mPipeHandleRead, pIoVectors, NumIoVectors)) < 0 && errno == EINTR) {}
+        CO_SIM_IO_ERROR_IF(bytes_read < 0) << "Error in reading from Pipe!" << std::endl;
+        CO_SIM_IO_ERROR_IF(bytes_read == 0) << "Pipe was closed by the partner!" << std::endl;
+        return static_cast<std::size_t>(bytes_read);
+    });
+    #endif
+}
+
+bool PipeCommunication::BidirectionalPipe::UseVmsplice(const std::size_t NumBytes) const
+{
+    return mUseVmsplice && NumBytes >= VMSPLICE_MIN_SIZE;
+}
+
+void PipeCommunication::BidirectionalPipe::SpliceBuffers(const std::vector<std::pair<char*, std::size_t>>& rBuffers)
+{
+    #ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    TransferBuffers(rBuffers, mBufferSize, [this](const iovec* pIoVectors, const int NumIoVectors) -> std::size_t {
+        ssize_t bytes_spliced;
+        while ((bytes_spliced = vmsplice(mPipeHandleWrite, pIoVectors, static_cast<unsigned long>(NumIoVectors), 0)) < 0 && errno == EINTR) {}
+        CO_SIM_IO_ERROR_IF(bytes_spliced < 0) << "Error in splicing to Pipe!" << std::endl;
+        return static_cast<std::size_t>(bytes_spliced);
+    });
+    #else
+    CO_SIM_IO_ERROR << "vmsplice is only available in Linux!" << std::endl;
+    #endif
+}
+
+void PipeCommunication::BidirectionalPipe::SendAcknowledgement()
+{
+    const char ack = 1;
+    WriteBytes(&ack, 1);
+}
+
+void PipeCommunication::BidirectionalPipe::WaitForAcknowledgement()
+{
+    char ack = 0;
+    ReadBytes(&ack, 1);
+    CO_SIM_IO_ERROR_IF(ack != 1) << "Received invalid acknowledgement through Pipe!" << std::endl;
+}
+
 double PipeCommunication::SendString(
     const Info& I_Info,
     const std::string& rData)
@@ -229,5 +479,20 @@ double PipeCommunication::ReceiveDataContainer(
     return mpPipe->Read(rData, sizeof(double));
 }
 
+double PipeCommunication::SendDataBuffers(
+    const Info& I_Info,
+    const std::string& rHeader,
+    const std::vector<ConstDataBufferType>& rBuffers)
+{
+    return mpPipe->WriteBatch(rHeader, rBuffers);
+}
+
+double PipeCommunication::ReceiveDataBuffers(
+    const Info& I_Info,
+    const std::function<std::vector<DataBufferType>(const std::string&)>& rHeaderReceived)
+{
+    return mpPipe->ReadBatch(rHeaderReceived);
+}
+
 } // namespace Internals
 } // namespace CoSimIO
@@ -0,0 +1,316 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include "includes/define.hpp" // for "CO_SIM_IO_COMPILED_IN_WINDOWS"
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <sstream>
+#include <thread>
+
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// External includes
+
+// Project includes
+#include "includes/communication/shared_memory_communication.hpp"
+#include "includes/utilities.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+namespace {
+
+std::size_t GetSharedMemoryBufferSize(const Info& I_Info)
+{
+    const std::size_t buffer_size = I_Info.Get<std::size_t>("buffer_size", 4194304); // 4 MB
+    CO_SIM_IO_ERROR_IF(buffer_size < 1024) << "\"buffer_size\" must be at least 1024 bytes, got " << buffer_size << "!" << std::endl;
+    return buffer_size;
+}
+
+// waiting for the partner is done by spinning first (lowest latency)
+// and then backing off with increasingly long sleeps to not burn a core while the partner is busy
+class Backoff
+{
+public:
+    void Wait()
+    {
+        if (mCounter < 100) {
+            ++mCounter;
+        } else if (mCounter < 1000) {
+            ++mCounter;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(mSleepTime));
+            if (mSleepTime < 1000) {mSleepTime *= 2;}
+        }
+    }
+
+private:
+    std::size_t mCounter = 0;
+    std::size_t mSleepTime = 1; // microseconds
+};
+
+} // anonymous namespace
+
+// this is placed at the beginning of the shared memory segment, followed by the data
+// the positions are on different cache lines to avoid false sharing between producer and consumer
+struct SharedMemoryCommunication::RingBuffer::Header
+{
+    alignas(64) std::atomic<std::uint64_t> mWritePosition;
+    alignas(64) std::atomic<std::uint64_t> mReadPosition;
+};
+
+SharedMemoryCommunication::SharedMemoryCommunication(
+    const Info& I_Settings,
+    std::shared_ptr<DataCommunicator> I_DataComm)
+    : Communication(I_Settings, I_DataComm),
+      mBufferSize(GetSharedMemoryBufferSize(I_Settings))
+{
+    // the positions are accessed by both processes, this only works if the atomics are not implemented with locks
+    CO_SIM_IO_ERROR_IF_NOT(std::atomic<std::uint64_t>().is_lock_free()) << "Shared memory communication requires lock-free 64-bit atomics, which are not available on this platform!" << std::endl;
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+    if (GetIsConnected()) {
+        CO_SIM_IO_INFO("CoSimIO") << "Warning: Disconnect was not performed, attempting automatic disconnection!" << std::endl;
+        Info tmp;
+        Disconnect(tmp);
+    }
+}
+
+Info SharedMemoryCommunication::ConnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetDataCommunicator().IsDistributed() && GetDataCommunicator().Rank()==0) << "Warning: Connection was done with MPI, but shared memory based communication works only within the same machine. Communicating between different compute nodes in a distributed memory machine when does not work, it will hang!" << std::endl;
+
+    // names of shared memory objects are global to the machine, hence the communication directory
+    // is included to avoid clashes between different couplings running at the same time
+    std::stringstream base_name;
+    base_name << "/CoSimIO_" << std::hex << std::hash<std::string>()(fs::absolute(GetCommunicationDirectory()).string())
+              << std::dec << "_" << GetConnectionName() << "_r" << GetDataCommunicator().Rank();
+
+    const std::string name_p2s = base_name.str() + "_p2s";
+    const std::string name_s2p = base_name.str() + "_s2p";
+
+    // the synchronization is also done by the ranks without partner rank as it is collective
+    if (GetIsPrimaryConnection() && HasPartnerRank()) {
+        mpSendBuffer    = std::make_shared<RingBuffer>(name_p2s, mBufferSize, true);
+        mpReceiveBuffer = std::make_shared<RingBuffer>(name_s2p, mBufferSize, true);
+    }
+
+    SynchronizeAll("shm_1");
+
+    if (!GetIsPrimaryConnection() && HasPartnerRank()) {
+        mpSendBuffer    = std::make_shared<RingBuffer>(name_s2p, mBufferSize, false);
+        mpReceiveBuffer = std::make_shared<RingBuffer>(name_p2s, mBufferSize, false);
+    }
+
+    SynchronizeAll("shm_2");
+
+    // both partners have mapped the segments, hence the names can be removed already
+    // this way no leftovers remain in case one of the partners crashes
+    if (GetIsPrimaryConnection() && HasPartnerRank()) {
+        mpSendBuffer->Unlink();
+        mpReceiveBuffer->Unlink();
+    }
+
+    return Info(); // TODO use
+
+    CO_SIM_IO_CATCH
+}
+
+Info SharedMemoryCommunication::DisconnectDetail(const Info& I_Info)
+{
+    if (mpSendBuffer) {
+        mpSendBuffer->Close();
+        mpReceiveBuffer->Close();
+        mpSendBuffer.reset();
+        mpReceiveBuffer.reset();
+    }
+    return Info(); // TODO use
+}
+
+void SharedMemoryCommunication::DerivedHandShake() const
+{
+    CO_SIM_IO_ERROR_IF(GetMyInfo().Get<std::string>("operating_system") != GetPartnerInfo().Get<std::string>("operating_system")) << "Shared memory communication cannot be used between different operating systems!" << std::endl;
+
+    const std::size_t my_buffer_size = GetMyInfo().Get<Info>("communication_settings").Get<std::size_t>("buffer_size");
+    const std::size_t partner_buffer_size = GetPartnerInfo().Get<Info>("communication_settings").Get<std::size_t>("buffer_size");
+    CO_SIM_IO_ERROR_IF(my_buffer_size != partner_buffer_size) << "Mismatch in buffer_size!\nMy buffer_size: " << my_buffer_size << "\nPartner buffer_size: " << partner_buffer_size << std::endl;
+}
+
+Info SharedMemoryCommunication::GetCommunicationSettings() const
+{
+    CO_SIM_IO_TRY
+
+    Info info;
+    info.Set("buffer_size", mBufferSize);
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+
+SharedMemoryCommunication::RingBuffer::RingBuffer(
+    const std::string& rName,
+    const std::size_t Capacity,
+    const bool Create)
+    : mName(rName),
+      mCapacity(Capacity)
+{
+    CO_SIM_IO_TRY
+
+    #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+    CO_SIM_IO_ERROR << "Shared memory communication is not yet implemented for Windows!" << std::endl;
+    #else
+    mMappedSize = sizeof(Header) + mCapacity;
+
+    int fd;
+    if (Create) {
+        shm_unlink(mName.c_str()); // remove potential leftovers from previous executions
+        CO_SIM_IO_ERROR_IF((fd = shm_open(mName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600)) < 0) << "Shared memory segment " << mName << " could not be created!" << std::endl;
+        if (ftruncate(fd, static_cast<off_t>(mMappedSize)) != 0) {
+            close(fd);
+            shm_unlink(mName.c_str());
+            CO_SIM_IO_ERROR << "Shared memory segment " << mName << " could not be resized to " << mMappedSize << " bytes!" << std::endl;
+        }
+    } else {
+        CO_SIM_IO_ERROR_IF((fd = shm_open(mName.c_str(), O_RDWR, 0600)) < 0) << "Shared memory segment " << mName << " could not be opened!" << std::endl;
+    }
+
+    void* p_mem = mmap(nullptr, mMappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); // the mapping stays valid after closing the file descriptor
+    CO_SIM_IO_ERROR_IF(p_mem == MAP_FAILED) << "Shared memory segment " << mName << " could not be mapped!" << std::endl;
+
+    if (Create) {
+        mpHeader = new (p_mem) Header();
+        mpHeader->mWritePosition.store(0);
+        mpHeader->mReadPosition.store(0);
+    } else {
+        mpHeader = static_cast<Header*>(p_mem);
+    }
+
+    mpData = static_cast<char*>(p_mem) + sizeof(Header);
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+void SharedMemoryCommunication::RingBuffer::Unlink()
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    shm_unlink(mName.c_str());
+    #endif
+}
+
+void SharedMemoryCommunication::RingBuffer::Close()
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    if (mpHeader) {
+        munmap(mpHeader, mMappedSize);
+        mpHeader = nullptr;
+        mpData = nullptr;
+    }
+    #endif
+}
+
+void SharedMemoryCommunication::RingBuffer::WriteBytes(const char* pData, const std::size_t Size)
+{
+    std::size_t written_size = 0;
+    std::uint64_t write_pos = mpHeader->mWritePosition.load(std::memory_order_relaxed); // only modified by this side
+
+    while (written_size < Size) {
+        Backoff backoff;
+        std::uint64_t free_size;
+        while ((free_size = mCapacity - (write_pos - mpHeader->mReadPosition.load(std::memory_order_acquire))) == 0) {
+            backoff.Wait();
+        }
+
+        const std::size_t offset = write_pos % mCapacity;
+        const std::size_t size_to_end = mCapacity - offset;
+        std::size_t current_size = std::min<std::size_t>(Size - written_size, free_size);
+        current_size = std::min(current_size, size_to_end); // wrap-around is done in the next iteration
+
+        std::memcpy(mpData + offset, pData + written_size, current_size);
+
+        written_size += current_size;
+        write_pos += current_size;
+        mpHeader->mWritePosition.store(write_pos, std::memory_order_release);
+    }
+}
+
+void SharedMemoryCommunication::RingBuffer::ReadBytes(char* pData, const std::size_t Size)
+{
+    std::size_t read_size = 0;
+    std::uint64_t read_pos = mpHeader->mReadPosition.load(std::memory_order_relaxed); // only modified by this side
+
+    while (read_size < Size) {
+        Backoff backoff;
+        std::uint64_t available_size;
+        while ((available_size = mpHeader->mWritePosition.load(std::memory_order_acquire) - read_pos) == 0) {
+            backoff.Wait();
+        }
+
+        const std::size_t offset = read_pos % mCapacity;
+        const std::size_t size_to_end = mCapacity - offset;
+        std::size_t current_size = std::min<std::size_t>(Size - read_size, available_size);
+        current_size = std::min(current_size, size_to_end); // wrap-around is done in the next iteration
+
+        std::memcpy(pData + read_size, mpData + offset, current_size);
+
+        read_size += current_size;
+        read_pos += current_size;
+        mpHeader->mReadPosition.store(read_pos, std::memory_order_release);
+    }
+}
+
+double SharedMemoryCommunication::SendString(
+    const Info& I_Info,
+    const std::string& rData)
+{
+    return mpSendBuffer->Write(rData, 1);
+}
+
+double SharedMemoryCommunication::ReceiveString(
+    const Info& I_Info,
+    std::string& rData)
+{
+    return mpReceiveBuffer->Read(rData, 1);
+}
+
+double SharedMemoryCommunication::SendDataContainer(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    return mpSendBuffer->Write(rData, sizeof(double));
+}
+
+double SharedMemoryCommunication::ReceiveDataContainer(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    return mpReceiveBuffer->Read(rData, sizeof(double));
+}
+
+} // namespace Internals
+} // namespace CoSimIO
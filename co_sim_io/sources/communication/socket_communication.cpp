@@ -12,6 +12,8 @@
 
 // System includes
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
 
 // Project includes
 #include "includes/communication/socket_communication.hpp"
@@ -19,6 +21,10 @@
 #ifdef CO_SIM_IO_COMPILED_IN_LINUX
 // to detect network interfaces
 #include <ifaddrs.h>
+// for the socket options that are not supported by asio
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 #endif
 
 namespace CoSimIO {
@@ -125,15 +131,55 @@ void RevertAsciiSerialization(std::string& rString)
     std::replace(rString.begin(), rString.end(), '>', '"');
 }
 
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+void SetNativeSocketOption(
+    asio::ip::tcp::socket& rSocket,
+    const int Level,
+    const int Name,
+    const int Value,
+    const std::string& rOptionName)
+{
+    const int err = setsockopt(rSocket.native_handle(), Level, Name, &Value, sizeof(Value));
+    CO_SIM_IO_ERROR_IF(err != 0) << "Setting socket option \"" << rOptionName << "\" to " << Value << " failed with error: " << std::strerror(errno) << std::endl;
+}
+
+int GetNativeSocketOption(
+    asio::ip::tcp::socket& rSocket,
+    const int Level,
+    const int Name)
+{
+    int value = 0;
+    socklen_t value_size = sizeof(value);
+    getsockopt(rSocket.native_handle(), Level, Name, &value, &value_size);
+    return value;
+}
+#endif
+
 } // helpers namespace
 
 SocketCommunication::SocketCommunication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
-    : BaseType(I_Settings, I_DataComm)
+    : BaseType(I_Settings, I_DataComm),
+      mNumStreams(I_Settings.Get<int>("num_streams", 1)),
+      mTcpNoDelay(I_Settings.Get<bool>("tcp_no_delay", false)),
+      mSendBufferSize(I_Settings.Get<int>("send_buffer_size", 0)),
+      mReceiveBufferSize(I_Settings.Get<int>("receive_buffer_size", 0)),
+      mBusyPoll(I_Settings.Get<int>("busy_poll", 0)),
+      mQuickAck(I_Settings.Get<bool>("quick_ack", false))
 {
     CO_SIM_IO_TRY
 
+    CO_SIM_IO_ERROR_IF(mNumStreams < 1) << "\"num_streams\" must be at least 1, got: " << mNumStreams << "!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mSendBufferSize < 0) << "\"send_buffer_size\" must not be negative, got: " << mSendBufferSize << "!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mReceiveBufferSize < 0) << "\"receive_buffer_size\" must not be negative, got: " << mReceiveBufferSize << "!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mBusyPoll < 0) << "\"busy_poll\" must not be negative, got: " << mBusyPoll << "!" << std::endl;
+
+#ifndef CO_SIM_IO_COMPILED_IN_LINUX
+    CO_SIM_IO_INFO_IF("CoSimIO", mBusyPoll > 0) << "Warning: \"busy_poll\" is only supported in Linux, it is ignored!" << std::endl;
+    CO_SIM_IO_INFO_IF("CoSimIO", mQuickAck) << "Warning: \"quick_ack\" is only supported in Linux, it is ignored!" << std::endl;
+#endif
+
     if (GetIsPrimaryConnection()) {
         mIpAddress = GetIpAddress(I_Settings);
     }
@@ -145,25 +191,59 @@ Info SocketCommunication::ConnectDetail(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    if (!HasPartnerRank()) {
+        // the acceptor was already created before the size of the partner was known
+        if (mpAsioAcceptor) {
+            mpAsioAcceptor->close();
+            mpAsioAcceptor.reset();
+        }
+        return BaseType::ConnectDetail(I_Info);
+    }
+
     if (!GetIsPrimaryConnection()) {GetConnectionInformation();}
 
     CO_SIM_IO_INFO_IF("CoSimIO", GetDataCommunicator().IsDistributed() && GetDataCommunicator().Rank()==0 && mIpAddress==LOCAL_IP_ADDRESS) << "Warning: Using the local IP address when connecting with MPI, this does not work in a distributed memory machine when communicating between different compute nodes!\nEither directly specify the IP address (with \"ip_address\") or specify the name of the network to be used (with \"network_name\")!" << std::endl;
 
-    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1) << "Using IP-Address: " << mIpAddress << " and port number: " << mPortNumber << std::endl;
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1) << "Using IP-Address: " << mIpAddress << " and port number: " << mPortNumber << " with " << mNumStreams << " stream(s)" << std::endl;
 
     using namespace asio::ip;
 
+    // the client connects the sockets one after the other, hence the server accepts them in the same order
     mpAsioSocket = std::make_shared<asio::ip::tcp::socket>(mAsioContext);
+    for (int i=1; i<mNumStreams; ++i) {
+        mpAsioStreamSockets.push_back(std::make_shared<asio::ip::tcp::socket>(mAsioContext));
+    }
+
     if (GetIsPrimaryConnection()) { // this is the server
+        // the accepted sockets inherit the buffer sizes from the acceptor
         mpAsioAcceptor->accept(*mpAsioSocket);
+        for (auto& rp_socket : mpAsioStreamSockets) {
+            mpAsioAcceptor->accept(*rp_socket);
+        }
         mpAsioAcceptor->close();
         mpAsioAcceptor.reset();
     } else { // this is the client
         tcp::endpoint my_endpoint(asio::ip::make_address(mIpAddress), mPortNumber);
+        // the buffer sizes have to be set before connecting, as they determine the TCP window scaling
+        mpAsioSocket->open(my_endpoint.protocol());
+        SetBufferSizes(*mpAsioSocket);
         mpAsioSocket->connect(my_endpoint);
+        for (auto& rp_socket : mpAsioStreamSockets) {
+            rp_socket->open(my_endpoint.protocol());
+            SetBufferSizes(*rp_socket);
+            rp_socket->connect(my_endpoint);
+        }
     }
 
-    return BaseType::ConnectDetail(I_Info);
+    SetSocketOptions(*mpAsioSocket);
+    for (auto& rp_socket : mpAsioStreamSockets) {
+        SetSocketOptions(*rp_socket);
+    }
+
+    Info info = BaseType::ConnectDetail(I_Info);
+    info.Set<Info>("socket_options", GetSocketOptions(*mpAsioSocket));
+
+    return info;
 
     CO_SIM_IO_CATCH
 }
@@ -178,6 +258,8 @@ void SocketCommunication::PrepareConnection(const Info& I_Info)
         tcp::endpoint port_selection_endpoint(asio::ip::make_address(mIpAddress), 0); // using port 0 means that it will look for a free port
         mpAsioAcceptor = std::make_shared<tcp::acceptor>(mAsioContext, port_selection_endpoint);
         mPortNumber = mpAsioAcceptor->local_endpoint().port();
+        if (mSendBufferSize > 0) {mpAsioAcceptor->set_option(asio::socket_base::send_buffer_size(mSendBufferSize));}
+        if (mReceiveBufferSize > 0) {mpAsioAcceptor->set_option(asio::socket_base::receive_buffer_size(mReceiveBufferSize));}
 
         // collect all IP-addresses and port numbers on rank 0 to
         // exchange them during the handshake (which happens only on rank 0)
@@ -208,11 +290,46 @@ void SocketCommunication::PrepareConnection(const Info& I_Info)
     CO_SIM_IO_CATCH
 }
 
+void SocketCommunication::DerivedHandShake() const
+{
+    CO_SIM_IO_TRY
+
+    const int my_num_streams = GetMyInfo().Get<Info>("communication_settings").Get<int>("num_streams");
+    const int partner_num_streams = GetPartnerInfo().Get<Info>("communication_settings").Get<int>("num_streams");
+    CO_SIM_IO_ERROR_IF(my_num_streams != partner_num_streams) << "Mismatch in num_streams!\nMy num_streams: " << my_num_streams << "\nPartner num_streams: " << partner_num_streams << std::endl;
+
+    const Info my_socket_options = GetMyInfo().Get<Info>("communication_settings").Get<Info>("socket_options");
+    const Info partner_socket_options = GetPartnerInfo().Get<Info>("communication_settings").Get<Info>("socket_options");
+
+    for (const std::string option : {"tcp_no_delay", "quick_ack"}) {
+        const bool my_value = my_socket_options.Get<bool>(option);
+        const bool partner_value = partner_socket_options.Get<bool>(option);
+        CO_SIM_IO_ERROR_IF(my_value != partner_value) << std::boolalpha << "Mismatch in " << option << "!\nMy " << option << ": " << my_value << "\nPartner " << option << ": " << partner_value << std::noboolalpha << std::endl;
+    }
+
+    for (const std::string option : {"send_buffer_size", "receive_buffer_size", "busy_poll"}) {
+        const int my_value = my_socket_options.Get<int>(option);
+        const int partner_value = partner_socket_options.Get<int>(option);
+        CO_SIM_IO_ERROR_IF(my_value != partner_value) << "Mismatch in " << option << "!\nMy " << option << ": " << my_value << "\nPartner " << option << ": " << partner_value << std::endl;
+    }
+
+    CO_SIM_IO_CATCH
+}
+
 Info SocketCommunication::GetCommunicationSettings() const
 {
     CO_SIM_IO_TRY
 
+    Info socket_options;
+    socket_options.Set("tcp_no_delay", mTcpNoDelay);
+    socket_options.Set("send_buffer_size", mSendBufferSize);
+    socket_options.Set("receive_buffer_size", mReceiveBufferSize);
+    socket_options.Set("busy_poll", mBusyPoll);
+    socket_options.Set("quick_ack", mQuickAck);
+
     Info info;
+    info.Set("num_streams", mNumStreams);
+    info.Set("socket_options", socket_options);
 
     if (GetIsPrimaryConnection() && GetDataCommunicator().Rank() == 0) {
         info.Set("connection_info", mSerializedConnectionInfo);
@@ -241,7 +358,7 @@ void SocketCommunication::GetConnectionInformation()
     StreamSerializer serializer(serialized_info, GetSerializerTraceType());
     serializer.load("conn_info", conn_infos);
 
-    CO_SIM_IO_ERROR_IF(static_cast<int>(conn_infos.size()) != GetDataCommunicator().Size()) << "Wrong number of connection infos!" << std::endl;
+    CO_SIM_IO_ERROR_IF(static_cast<int>(conn_infos.size()) != GetPartnerSize()) << "Wrong number of connection infos!" << std::endl;
 
     const auto& my_conn_info = conn_infos[GetDataCommunicator().Rank()];
     mPortNumber = my_conn_info.PortNumber;
@@ -250,5 +367,85 @@ void SocketCommunication::GetConnectionInformation()
     CO_SIM_IO_CATCH
 }
 
+void SocketCommunication::PrepareReceive()
+{
+    CO_SIM_IO_TRY
+
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    // quick ack mode is not permanent, the kernel disables it again after some time
+    if (mQuickAck) {
+        SetNativeSocketOption(*mpAsioSocket, IPPROTO_TCP, TCP_QUICKACK, 1, "quick_ack");
+    }
+#endif
+
+    CO_SIM_IO_CATCH
+}
+
+void SocketCommunication::SetBufferSizes(asio::ip::tcp::socket& rSocket) const
+{
+    CO_SIM_IO_TRY
+
+    if (mSendBufferSize > 0) {rSocket.set_option(asio::socket_base::send_buffer_size(mSendBufferSize));}
+    if (mReceiveBufferSize > 0) {rSocket.set_option(asio::socket_base::receive_buffer_size(mReceiveBufferSize));}
+
+    CO_SIM_IO_CATCH
+}
+
+void SocketCommunication::SetSocketOptions(asio::ip::tcp::socket& rSocket) const
+{
+    CO_SIM_IO_TRY
+
+    SetBufferSizes(rSocket);
+
+    rSocket.set_option(asio::ip::tcp::no_delay(mTcpNoDelay));
+
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    if (mBusyPoll > 0) {
+#ifdef SO_BUSY_POLL
+        // increasing the value above the system default (net.core.busy_read) requires CAP_NET_ADMIN
+        SetNativeSocketOption(rSocket, SOL_SOCKET, SO_BUSY_POLL, mBusyPoll, "busy_poll");
+#else
+        CO_SIM_IO_INFO("CoSimIO") << "Warning: \"busy_poll\" is not supported by this system, it is ignored!" << std::endl;
+#endif
+    }
+
+    if (mQuickAck) {
+        SetNativeSocketOption(rSocket, IPPROTO_TCP, TCP_QUICKACK, 1, "quick_ack");
+    }
+#endif
+
+    CO_SIM_IO_CATCH
+}
+
+Info SocketCommunication::GetSocketOptions(asio::ip::tcp::socket& rSocket) const
+{
+    CO_SIM_IO_TRY
+
+    // the values used by the OS, they can differ from the requested ones
+    // e.g. Linux doubles the requested buffer sizes to account for bookkeeping overhead
+    asio::ip::tcp::no_delay no_delay;
+    asio::socket_base::send_buffer_size send_buffer_size;
+    asio::socket_base::receive_buffer_size receive_buffer_size;
+    rSocket.get_option(no_delay);
+    rSocket.get_option(send_buffer_size);
+    rSocket.get_option(receive_buffer_size);
+
+    Info info;
+    info.Set<bool>("tcp_no_delay", no_delay.value());
+    info.Set<int>("send_buffer_size", send_buffer_size.value());
+    info.Set<int>("receive_buffer_size", receive_buffer_size.value());
+
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+#ifdef SO_BUSY_POLL
+    info.Set<int>("busy_poll", GetNativeSocketOption(rSocket, SOL_SOCKET, SO_BUSY_POLL));
+#endif
+    info.Set<bool>("quick_ack", GetNativeSocketOption(rSocket, IPPROTO_TCP, TCP_QUICKACK) != 0);
+#endif
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
 } // namespace Internals
 } // namespace CoSimIO
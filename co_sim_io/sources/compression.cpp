@@ -0,0 +1,223 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Project includes
+#include "includes/compression.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+namespace Compression {
+
+namespace {
+
+// the size of the prediction tables depends on the number of values, such that small arrays do not pay for large tables
+std::size_t GetTableSize(const std::size_t NumValues)
+{
+    std::size_t table_size = std::size_t(1) << 8;
+    while (table_size < (std::size_t(1) << 16) && table_size < NumValues) {
+        table_size <<= 1;
+    }
+    return table_size;
+}
+
+// two predictors, the finite context method (FCM) and the differential finite context method (DFCM)
+// both use a hash of the previous values (or their differences) to look up the prediction
+class FpcPredictor
+{
+public:
+    explicit FpcPredictor(const std::size_t NumValues)
+        : mMask(GetTableSize(NumValues)-1),
+          mFcmTable(mMask+1, 0),
+          mDfcmTable(mMask+1, 0)
+    {}
+
+    std::uint64_t PredictFcm() const {return mFcmTable[mFcmHash];}
+
+    std::uint64_t PredictDfcm() const {return mDfcmTable[mDfcmHash] + mLastValue;}
+
+    void Update(const std::uint64_t Value)
+    {
+        mFcmTable[mFcmHash] = Value;
+        mFcmHash = ((mFcmHash << 6) ^ (Value >> 48)) & mMask;
+
+        const std::uint64_t delta = Value - mLastValue;
+        mDfcmTable[mDfcmHash] = delta;
+        mDfcmHash = ((mDfcmHash << 2) ^ (delta >> 40)) & mMask;
+        mLastValue = Value;
+    }
+
+private:
+    const std::size_t mMask;
+    std::vector<std::uint64_t> mFcmTable;
+    std::vector<std::uint64_t> mDfcmTable;
+    std::size_t mFcmHash = 0;
+    std::size_t mDfcmHash = 0;
+    std::uint64_t mLastValue = 0;
+};
+
+// each value has a header of 4 bits: 1 bit for the predictor and 3 bits for the number of leading zero bytes of the residual
+// 4 leading zero bytes cannot be encoded with 3 bits, this case is stored as 3 leading zero bytes
+const unsigned int DFCM_FLAG = 8;
+
+unsigned int CountLeadingZeroBytes(const std::uint64_t Residual)
+{
+    unsigned int num_bytes = 0;
+    while (num_bytes < 8 && ((Residual >> (56-8*num_bytes)) & 0xff) == 0) {
+        ++num_bytes;
+    }
+    return (num_bytes == 4) ? 3 : num_bytes;
+}
+
+unsigned int EncodeLeadingZeroBytes(const unsigned int NumBytes) {return (NumBytes > 4) ? NumBytes-1 : NumBytes;}
+
+unsigned int DecodeLeadingZeroBytes(const unsigned int Code) {return (Code > 3) ? Code+1 : Code;}
+
+void WriteSize(const std::uint64_t Size, unsigned char* pBuffer)
+{
+    for (std::size_t i=0; i<sizeof(Size); ++i) {
+        pBuffer[i] = static_cast<unsigned char>(Size >> (8*i));
+    }
+}
+
+std::uint64_t ReadSize(const unsigned char* pBuffer)
+{
+    std::uint64_t size = 0;
+    for (std::size_t i=0; i<sizeof(size); ++i) {
+        size |= static_cast<std::uint64_t>(pBuffer[i]) << (8*i);
+    }
+    return size;
+}
+
+} // anonymous namespace
+
+CompressionType StringToCompressionType(const std::string& rCompression)
+{
+    if (rCompression == "none") {return CompressionType::None;}
+    else if (rCompression == "fpc") {return CompressionType::Fpc;}
+    else {CO_SIM_IO_ERROR << "Invalid compression \"" << rCompression << "\"! Valid options are: none, fpc" << std::endl;}
+    return CompressionType::None;
+}
+
+std::string CompressionTypeToString(const CompressionType Compression)
+{
+    switch (Compression) {
+        case CompressionType::None: return "none";
+        case CompressionType::Fpc:  return "fpc";
+    }
+    return "unknown";
+}
+
+// layout: number of values (8 bytes) | headers (4 bits per value) | residuals (0-8 bytes per value)
+std::string CompressFpc(
+    const double* pData,
+    const std::size_t Size)
+{
+    CO_SIM_IO_TRY
+
+    const std::size_t headers_size = (Size+1)/2;
+
+    std::string compressed_data(sizeof(std::uint64_t) + headers_size + Size*sizeof(double), '\0'); // worst case
+    unsigned char* p_begin = reinterpret_cast<unsigned char*>(&compressed_data[0]);
+    unsigned char* p_headers = p_begin + sizeof(std::uint64_t);
+    unsigned char* p_residuals = p_headers + headers_size;
+
+    WriteSize(Size, p_begin);
+
+    FpcPredictor predictor(Size);
+
+    for (std::size_t i=0; i<Size; ++i) {
+        std::uint64_t value;
+        std::memcpy(&value, pData+i, sizeof(value));
+
+        const std::uint64_t residual_fcm = value ^ predictor.PredictFcm();
+        const std::uint64_t residual_dfcm = value ^ predictor.PredictDfcm();
+        predictor.Update(value);
+
+        // the smaller residual has more leading zero bytes
+        const bool use_dfcm = residual_dfcm < residual_fcm;
+        const std::uint64_t residual = use_dfcm ? residual_dfcm : residual_fcm;
+        const unsigned int num_zero_bytes = CountLeadingZeroBytes(residual);
+
+        const unsigned int header = (use_dfcm ? DFCM_FLAG : 0) | EncodeLeadingZeroBytes(num_zero_bytes);
+        p_headers[i/2] |= static_cast<unsigned char>(header << (4*(i%2)));
+
+        for (unsigned int j=0; j<8-num_zero_bytes; ++j) {
+            *p_residuals++ = static_cast<unsigned char>(residual >> (8*j));
+        }
+    }
+
+    compressed_data.resize(static_cast<std::size_t>(p_residuals - p_begin));
+
+    return compressed_data;
+
+    CO_SIM_IO_CATCH
+}
+
+void DecompressFpc(
+    const std::string& rCompressedData,
+    DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF(rCompressedData.size() < sizeof(std::uint64_t)) << "Invalid compressed data!" << std::endl;
+
+    const unsigned char* p_begin = reinterpret_cast<const unsigned char*>(rCompressedData.data());
+    const unsigned char* p_end = p_begin + rCompressedData.size();
+
+    // the size is checked before allocating, each value needs at least half a byte for its header
+    const std::uint64_t size_read = ReadSize(p_begin);
+    const std::size_t max_size = 2*(rCompressedData.size() - sizeof(std::uint64_t));
+    CO_SIM_IO_ERROR_IF(size_read > max_size) << "Invalid compressed data!" << std::endl;
+
+    const std::size_t size = static_cast<std::size_t>(size_read);
+    const std::size_t headers_size = size/2 + size%2;
+
+    CO_SIM_IO_ERROR_IF(rCompressedData.size() < sizeof(std::uint64_t) + headers_size) << "Invalid compressed data!" << std::endl;
+
+    const unsigned char* p_headers = p_begin + sizeof(std::uint64_t);
+    const unsigned char* p_residuals = p_headers + headers_size;
+
+    rData.resize(size);
+    double* p_data = rData.data();
+
+    FpcPredictor predictor(size);
+
+    for (std::size_t i=0; i<size; ++i) {
+        const unsigned int header = (p_headers[i/2] >> (4*(i%2))) & 0xf;
+        const unsigned int num_bytes = 8 - DecodeLeadingZeroBytes(header & 7);
+
+        CO_SIM_IO_ERROR_IF(p_residuals + num_bytes > p_end) << "Invalid compressed data!" << std::endl;
+
+        std::uint64_t residual = 0;
+        for (unsigned int j=0; j<num_bytes; ++j) {
+            residual |= static_cast<std::uint64_t>(*p_residuals++) << (8*j);
+        }
+
+        const std::uint64_t value = residual ^ ((header & DFCM_FLAG) ? predictor.PredictDfcm() : predictor.PredictFcm());
+        predictor.Update(value);
+
+        std::memcpy(p_data+i, &value, sizeof(value));
+    }
+
+    CO_SIM_IO_ERROR_IF(p_residuals != p_end) << "Invalid compressed data!" << std::endl;
+
+    CO_SIM_IO_CATCH
+}
+
+} // namespace Compression
+} // namespace Internals
+} // namespace CoSimIO
@@ -11,6 +11,7 @@
 //
 
 // System includes
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -23,20 +24,36 @@ namespace Internals {
 
 static std::unordered_map<std::string, std::unique_ptr<Internals::Connection>> s_co_sim_connections;
 
+// protects the map of connections, such that different connections can be used from different threads
+// Note: the connections themselves are not protected, i.e. one connection must not be used by several threads at the same time
+static std::mutex s_co_sim_connections_mutex;
+
 bool HasConnection(const std::string& rConnectionName)
 {
+    std::lock_guard<std::mutex> lock(s_co_sim_connections_mutex);
     return s_co_sim_connections.find(rConnectionName) != s_co_sim_connections.end();
 }
 
 Connection& GetConnection(const std::string& rConnectionName)
 {
-    CO_SIM_IO_ERROR_IF_NOT(HasConnection(rConnectionName)) << "Trying to use connection \"" << rConnectionName << "\" which does not exist!" << std::endl;
-    return *s_co_sim_connections.at(rConnectionName);
+    std::lock_guard<std::mutex> lock(s_co_sim_connections_mutex);
+    auto it_conn = s_co_sim_connections.find(rConnectionName);
+    CO_SIM_IO_ERROR_IF(it_conn == s_co_sim_connections.end()) << "Trying to use connection \"" << rConnectionName << "\" which does not exist!" << std::endl;
+    return *(it_conn->second); // the connection is owned by a unique_ptr, hence the reference stays valid when the map is modified
 }
 
 void RemoveConnection(const std::string& rConnectionName)
 {
-    s_co_sim_connections.erase(rConnectionName);
+    std::unique_ptr<Internals::Connection> p_connection; // destroying the connection outside of the lock, as this can take time
+
+    {
+        std::lock_guard<std::mutex> lock(s_co_sim_connections_mutex);
+        auto it_conn = s_co_sim_connections.find(rConnectionName);
+        if (it_conn != s_co_sim_connections.end()) {
+            p_connection = std::move(it_conn->second);
+            s_co_sim_connections.erase(it_conn);
+        }
+    }
 }
 
 Info ConnectImpl(
@@ -54,14 +71,24 @@ Info ConnectImpl(
 
     const std::string connection_name = Utilities::CreateConnectionName(my_name, connect_to);
 
-    CO_SIM_IO_ERROR_IF(HasConnection(connection_name)) << "A connection from \"" << my_name << "\" to \"" << connect_to << "\"already exists!" << std::endl;
+    Connection* p_connection;
+
+    {
+        // checking and adding in one go, such that the same connection cannot be created concurrently
+        std::lock_guard<std::mutex> lock(s_co_sim_connections_mutex);
+
+        CO_SIM_IO_ERROR_IF(s_co_sim_connections.find(connection_name) != s_co_sim_connections.end()) << "A connection from \"" << my_name << "\" to \"" << connect_to << "\"already exists!" << std::endl;
 
-    s_co_sim_connections[connection_name] = CoSimIO::make_unique<Connection>(
-        I_Settings,
-        I_DataComm,
-        rCommFactory);
+        auto p_new_connection = CoSimIO::make_unique<Connection>(
+            I_Settings,
+            I_DataComm,
+            rCommFactory);
+        p_connection = p_new_connection.get();
+        s_co_sim_connections[connection_name] = std::move(p_new_connection);
+    }
 
-    auto info = GetConnection(connection_name).Connect(I_Settings);
+    // connecting is blocking and is hence done outside of the lock
+    auto info = p_connection->Connect(I_Settings);
     info.Set<std::string>("connection_name", connection_name);
 
     return info;
@@ -80,6 +80,7 @@ Info Connection::Run(const Info& I_Info)
                 err_msg << "\n    end" << std::endl;
                 CO_SIM_IO_ERROR << err_msg.str();
             }
+            const Tracer::Scope trace_scope(mpComm->GetTracer(), control_signal, "run_control");
             it_fct->second(info.Get<Info>("settings", Info{})); // pass settings if specified
         }
     }
@@ -23,14 +23,15 @@ Node::Node(
     const double I_X,
     const double I_Y,
     const double I_Z)
-: mId(I_Id),
-    mX(I_X),
-    mY(I_Y),
-    mZ(I_Z)
+: mpOwnData(CoSimIO::make_unique<Internals::NodesData>())
 {
     CO_SIM_IO_ERROR_IF(I_Id < 1) << "Id must be >= 1!" << std::endl;
+    mpOwnData->push_back(I_Id, I_X, I_Y, I_Z, -1);
+    mpData = mpOwnData.get();
 }
 
+Node::~Node() = default;
+
 void Node::Print(std::ostream& rOStream) const
 {
     rOStream << "CoSimIO-Node; Id: " << Id() << "\n";
@@ -39,18 +40,18 @@ void Node::Print(std::ostream& rOStream) const
 
 void Node::save(CoSimIO::Internals::Serializer& rSerializer) const
 {
-    rSerializer.save("mId", mId);
-    rSerializer.save("mX", mX);
-    rSerializer.save("mY", mY);
-    rSerializer.save("mZ", mZ);
+    rSerializer.save("mId", Id());
+    rSerializer.save("mX", X());
+    rSerializer.save("mY", Y());
+    rSerializer.save("mZ", Z());
 }
 
 void Node::load(CoSimIO::Internals::Serializer& rSerializer)
 {
-    rSerializer.load("mId", mId);
-    rSerializer.load("mX", mX);
-    rSerializer.load("mY", mY);
-    rSerializer.load("mZ", mZ);
+    rSerializer.load("mId", mpData->Ids[mIndex]);
+    rSerializer.load("mX", mpData->X[mIndex]);
+    rSerializer.load("mY", mpData->Y[mIndex]);
+    rSerializer.load("mZ", mpData->Z[mIndex]);
 }
 
 Element::Element(
@@ -134,10 +135,10 @@ Node& ModelPart::CreateNewNode(
     const double I_Z)
 {
     CO_SIM_IO_ERROR_IF(HasNode(I_Id)) << "The Node with Id " << I_Id << " exists already!" << std::endl;
+    CO_SIM_IO_ERROR_IF(I_Id < 1) << "Id must be >= 1!" << std::endl;
 
-    CoSimIO::intrusive_ptr<Node> new_node(CoSimIO::make_intrusive<Node>(I_Id, I_X, I_Y, I_Z));
+    NodePointerType new_node = AddNode(I_Id, I_X, I_Y, I_Z, -1);
 
-    mNodes.push_back(new_node, I_Id);
     GetLocalModelPart().mNodes.push_back(new_node, I_Id);
 
     return *new_node;
@@ -152,10 +153,10 @@ Node& ModelPart::CreateNewGhostNode(
 {
     CO_SIM_IO_ERROR_IF(HasNode(I_Id)) << "The Node with Id " << I_Id << " exists already!" << std::endl;
     CO_SIM_IO_ERROR_IF(PartitionIndex<0) << "PartitionIndex must be >= 0!" << std::endl;
+    CO_SIM_IO_ERROR_IF(I_Id < 1) << "Id must be >= 1!" << std::endl;
 
-    CoSimIO::intrusive_ptr<Node> new_node(CoSimIO::make_intrusive<Node>(I_Id, I_X, I_Y, I_Z));
+    NodePointerType new_node = AddNode(I_Id, I_X, I_Y, I_Z, PartitionIndex);
 
-    mNodes.push_back(new_node, I_Id);
     GetGhostModelPart().mNodes.push_back(new_node, I_Id);
     GetPartitionModelPart(PartitionIndex).mNodes.push_back(new_node, I_Id);
 
@@ -243,6 +244,9 @@ void ModelPart::Clear()
 
     mNodes.clear();
     mNodes.shrink_to_fit();
+
+    // the existing Nodes remain valid as long as they are referenced
+    mpNodesStorage = nullptr;
 }
 
 ModelPart::NodesContainerType::const_iterator ModelPart::FindNode(const IdType I_Id) const
@@ -275,6 +279,27 @@ bool ModelPart::HasElement(const IdType I_Id) const
     return mElements.contains(I_Id);
 }
 
+Internals::NodesStorage& ModelPart::GetNodesStorage()
+{
+    if (!mpNodesStorage) {
+        mpNodesStorage = CoSimIO::make_intrusive<Internals::NodesStorage>();
+    }
+    return *mpNodesStorage;
+}
+
+ModelPart::NodePointerType ModelPart::AddNode(
+    const IdType I_Id,
+    const double I_X,
+    const double I_Y,
+    const double I_Z,
+    const int PartitionIndex)
+{
+    NodePointerType new_node(&GetNodesStorage().AddNode(I_Id, I_X, I_Y, I_Z, PartitionIndex));
+    mNodes.push_back(new_node, I_Id);
+
+    return new_node;
+}
+
 ModelPart& ModelPart::GetLocalModelPart()
 {
     CO_SIM_IO_ERROR_IF_NOT(mpLocalModelPart) << "Internal ModelPart, access is not allowed!" << std::endl;
@@ -333,24 +358,101 @@ void ModelPart::InitializeInternalModelParts()
     mpGhostModelPart = std::unique_ptr<ModelPart>(new ModelPart("ghost", false));
 }
 
+// the ModelPart is serialized in a flat layout (arrays of Ids, coordinates etc) instead of the individual objects
+// this way the serializer can stream the data in blocks and does not need to track the pointers of the Nodes
+// the nodal data is already stored in this layout
 void ModelPart::save(CoSimIO::Internals::Serializer& rSerializer) const
 {
+    const std::size_t num_elements = NumberOfElements();
+
+    std::vector<IdType> element_ids(num_elements);
+    std::vector<int> element_types(num_elements);
+    std::vector<int> element_num_nodes(num_elements);
+    std::vector<IdType> element_connectivities;
+    element_connectivities.reserve(num_elements*4); // rough estimate
+
+    std::size_t i = 0;
+    for (const auto& rp_elem : mElements) {
+        element_ids[i] = rp_elem->Id();
+        element_types[i] = static_cast<int>(rp_elem->Type());
+        element_num_nodes[i] = static_cast<int>(rp_elem->NumberOfNodes());
+        for (auto it_node = rp_elem->NodesBegin(); it_node != rp_elem->NodesEnd(); ++it_node) {
+            element_connectivities.push_back((*it_node)->Id());
+        }
+        ++i;
+    }
+
+    const Internals::NodesData empty_nodes_data;
+    const Internals::NodesData& r_nodes_data = mpNodesStorage ? mpNodesStorage->Data : empty_nodes_data;
+
     rSerializer.save("mName", mName);
-    rSerializer.save("mNodes", mNodes);
-    rSerializer.save("mElements", mElements);
-    rSerializer.save("mpLocalModelPart", mpLocalModelPart);
-    rSerializer.save("mpGhostModelPart", mpGhostModelPart);
-    rSerializer.save("mPartitionModelParts", mPartitionModelParts);
+    rSerializer.save("node_ids", r_nodes_data.Ids);
+    rSerializer.save("node_x", r_nodes_data.X);
+    rSerializer.save("node_y", r_nodes_data.Y);
+    rSerializer.save("node_z", r_nodes_data.Z);
+    rSerializer.save("node_partitions", r_nodes_data.PartitionIndices);
+    rSerializer.save("element_ids", element_ids);
+    rSerializer.save("element_types", element_types);
+    rSerializer.save("element_num_nodes", element_num_nodes);
+    rSerializer.save("element_connectivities", element_connectivities);
 }
 
 void ModelPart::load(CoSimIO::Internals::Serializer& rSerializer)
 {
+    Clear();
+
+    // the nodal data is loaded directly, only the Nodes referring to it are created afterwards
+    Internals::NodesStorage& r_nodes_storage = GetNodesStorage();
+    Internals::NodesData& r_nodes_data = r_nodes_storage.Data;
+
     rSerializer.load("mName", mName);
-    rSerializer.load("mNodes", mNodes);
-    rSerializer.load("mElements", mElements);
-    rSerializer.load("mpLocalModelPart", mpLocalModelPart);
-    rSerializer.load("mpGhostModelPart", mpGhostModelPart);
-    rSerializer.load("mPartitionModelParts", mPartitionModelParts);
+    rSerializer.load("node_ids", r_nodes_data.Ids);
+    rSerializer.load("node_x", r_nodes_data.X);
+    rSerializer.load("node_y", r_nodes_data.Y);
+    rSerializer.load("node_z", r_nodes_data.Z);
+    rSerializer.load("node_partitions", r_nodes_data.PartitionIndices);
+
+    const std::size_t num_nodes = r_nodes_data.size();
+    CO_SIM_IO_ERROR_IF(r_nodes_data.X.size() != num_nodes || r_nodes_data.Y.size() != num_nodes || r_nodes_data.Z.size() != num_nodes || r_nodes_data.PartitionIndices.size() != num_nodes) << "Inconsistent nodal data!" << std::endl;
+
+    mNodes.reserve(num_nodes);
+    GetLocalModelPart().mNodes.reserve(num_nodes);
+    for (std::size_t i=0; i<num_nodes; ++i) {
+        const IdType node_id = r_nodes_data.Ids[i];
+        const int partition_index = r_nodes_data.PartitionIndices[i];
+        CO_SIM_IO_ERROR_IF(HasNode(node_id)) << "The Node with Id " << node_id << " exists already!" << std::endl;
+
+        r_nodes_storage.Nodes.emplace_back(r_nodes_storage, r_nodes_data, i);
+        NodePointerType p_node(&r_nodes_storage.Nodes.back());
+        mNodes.push_back(p_node, node_id);
+
+        if (partition_index < 0) {
+            GetLocalModelPart().mNodes.push_back(p_node, node_id);
+        } else {
+            GetGhostModelPart().mNodes.push_back(p_node, node_id);
+            GetPartitionModelPart(partition_index).mNodes.push_back(p_node, node_id);
+        }
+    }
+
+    std::vector<IdType> element_ids;
+    std::vector<int> element_types;
+    std::vector<int> element_num_nodes;
+    std::vector<IdType> element_connectivities;
+
+    rSerializer.load("element_ids", element_ids);
+    rSerializer.load("element_types", element_types);
+    rSerializer.load("element_num_nodes", element_num_nodes);
+    rSerializer.load("element_connectivities", element_connectivities);
+
+    mElements.reserve(element_ids.size());
+    GetLocalModelPart().mElements.reserve(element_ids.size());
+    ConnectivitiesType conn;
+    std::size_t conn_index = 0;
+    for (std::size_t i=0; i<element_ids.size(); ++i) {
+        conn.assign(element_connectivities.begin()+conn_index, element_connectivities.begin()+conn_index+element_num_nodes[i]);
+        conn_index += element_num_nodes[i];
+        CreateNewElement(element_ids[i], static_cast<ElementType>(element_types[i]), conn);
+    }
 }
 
 } //namespace CoSimIO
@@ -0,0 +1,192 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+// Project includes
+#include "includes/statistics.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+namespace {
+
+const double MIN_DURATION = 1e-7; // [s]
+const std::size_t BINS_PER_OCTAVE = 8;
+const std::size_t NUM_OCTAVES = 37; // MIN_DURATION * 2^37 ~ 4 hours
+const std::size_t NUM_BINS = BINS_PER_OCTAVE*NUM_OCTAVES;
+
+std::size_t GetBinIndex(const double Duration)
+{
+    if (!(Duration > MIN_DURATION)) {return 0;} // also catches NaN
+    const double index = std::floor(std::log2(Duration/MIN_DURATION) * BINS_PER_OCTAVE);
+    return std::min(static_cast<std::size_t>(index), NUM_BINS-1);
+}
+
+// geometric center of the bin
+double GetBinValue(const std::size_t Index)
+{
+    return MIN_DURATION * std::exp2((Index+0.5) / BINS_PER_OCTAVE);
+}
+
+} // anonymous namespace
+
+DurationHistogram::DurationHistogram()
+    : mBins(NUM_BINS, 0)
+{}
+
+void DurationHistogram::Add(const double Duration)
+{
+    ++mBins[GetBinIndex(Duration)];
+
+    if (mCount == 0) {
+        mMin = Duration;
+        mMax = Duration;
+    } else {
+        mMin = std::min(mMin, Duration);
+        mMax = std::max(mMax, Duration);
+    }
+
+    ++mCount;
+    mTotal += Duration;
+}
+
+double DurationHistogram::Mean() const
+{
+    return (mCount > 0) ? mTotal/mCount : 0.0;
+}
+
+double DurationHistogram::Percentile(const double Fraction) const
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF(Fraction < 0.0 || Fraction > 1.0) << "Fraction must be in [0, 1], got: " << Fraction << "!" << std::endl;
+
+    if (mCount == 0) {return 0.0;}
+
+    const std::size_t rank = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(Fraction*mCount)));
+
+    // the smallest and largest values are known exactly
+    if (rank == 1) {return mMin;}
+    if (rank == mCount) {return mMax;}
+
+    std::size_t cumulative_count = 0;
+    for (std::size_t i=0; i<mBins.size(); ++i) {
+        cumulative_count += mBins[i];
+        if (cumulative_count >= rank) {
+            return std::max(mMin, std::min(mMax, GetBinValue(i)));
+        }
+    }
+
+    return mMax;
+
+    CO_SIM_IO_CATCH
+}
+
+void Statistics::Record(
+    const std::string& rOperation,
+    const std::string& rIdentifier,
+    const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    Entry& r_entry = mEntries[std::make_pair(rOperation, rIdentifier)];
+    r_entry.ElapsedTime.Add(I_Info.Get<double>("elapsed_time"));
+    r_entry.ElapsedTimeIpc += I_Info.Get<double>("elapsed_time_ipc", 0.0);
+    r_entry.ElapsedTimeSerializer += I_Info.Get<double>("elapsed_time_serializer", 0.0);
+    r_entry.MemoryUsageIpc += I_Info.Get<std::size_t>("memory_usage_ipc");
+
+    CO_SIM_IO_CATCH
+}
+
+void Statistics::Clear()
+{
+    const std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+}
+
+Info Statistics::GetInfo() const
+{
+    CO_SIM_IO_TRY
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    Info info;
+
+    for (const auto& r_entry : mEntries) {
+        const DurationHistogram& r_hist = r_entry.second.ElapsedTime;
+
+        Info elapsed_time;
+        elapsed_time.Set<double>("total", r_hist.Total());
+        elapsed_time.Set<double>("min",   r_hist.Min());
+        elapsed_time.Set<double>("mean",  r_hist.Mean());
+        elapsed_time.Set<double>("p50",   r_hist.Percentile(0.5));
+        elapsed_time.Set<double>("p99",   r_hist.Percentile(0.99));
+        elapsed_time.Set<double>("max",   r_hist.Max());
+
+        // using int and double, as the C and Python interfaces do not support size_t
+        // the accumulated memory usage can exceed the range of int
+        Info identifier_info;
+        identifier_info.Set<int>("count", static_cast<int>(r_hist.Count()));
+        identifier_info.Set<double>("memory_usage_ipc", static_cast<double>(r_entry.second.MemoryUsageIpc));
+        identifier_info.Set<Info>("elapsed_time", elapsed_time);
+        identifier_info.Set<double>("elapsed_time_ipc", r_entry.second.ElapsedTimeIpc);
+        identifier_info.Set<double>("elapsed_time_serializer", r_entry.second.ElapsedTimeSerializer);
+
+        const std::string& r_operation = r_entry.first.first;
+        Info operation_info = info.Get<Info>(r_operation, Info());
+        operation_info.Set<Info>(r_entry.first.second, identifier_info);
+        info.Set<Info>(r_operation, operation_info);
+    }
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+void Statistics::Print(std::ostream& rOStream) const
+{
+    CO_SIM_IO_TRY
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto flags = rOStream.flags();
+    const auto precision = rOStream.precision();
+
+    rOStream << std::left << std::setw(20) << "operation" << std::setw(25) << "identifier" << std::right
+             << std::setw(8) << "count" << std::setw(14) << "bytes"
+             << std::setw(12) << "total [s]" << std::setw(12) << "mean [s]" << std::setw(12) << "p50 [s]"
+             << std::setw(12) << "p99 [s]" << std::setw(12) << "min [s]" << std::setw(12) << "max [s]" << "\n";
+
+    rOStream << std::setprecision(3);
+
+    for (const auto& r_entry : mEntries) {
+        const DurationHistogram& r_hist = r_entry.second.ElapsedTime;
+        rOStream << std::left << std::setw(20) << r_entry.first.first << std::setw(25) << r_entry.first.second << std::right
+                 << std::setw(8) << r_hist.Count() << std::setw(14) << r_entry.second.MemoryUsageIpc
+                 << std::setw(12) << r_hist.Total() << std::setw(12) << r_hist.Mean() << std::setw(12) << r_hist.Percentile(0.5)
+                 << std::setw(12) << r_hist.Percentile(0.99) << std::setw(12) << r_hist.Min() << std::setw(12) << r_hist.Max() << "\n";
+    }
+
+    rOStream.flags(flags);
+    rOStream.precision(precision);
+
+    CO_SIM_IO_CATCH
+}
+
+} // namespace Internals
+} // namespace CoSimIO
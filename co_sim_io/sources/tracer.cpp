@@ -0,0 +1,221 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+// Project includes
+#include "includes/tracer.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+namespace {
+
+// the threads of a rank get consecutive ids, such that they are shown together
+const int THREADS_PER_RANK = 1000;
+
+std::int64_t ToNanoseconds(const Tracer::ClockType::duration Duration)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Duration).count();
+}
+
+// the trace event format uses microseconds
+void WriteMicroseconds(std::ostream& rOStream, const std::int64_t Nanoseconds)
+{
+    rOStream << Nanoseconds/1000 << '.' << std::setw(3) << std::setfill('0') << Nanoseconds%1000;
+}
+
+void WriteJsonString(std::ostream& rOStream, const std::string& rString)
+{
+    rOStream << '"';
+    for (const char c : rString) {
+        switch (c) {
+            case '"':  rOStream << "\\\""; break;
+            case '\\': rOStream << "\\\\"; break;
+            case '\n': rOStream << "\\n"; break;
+            case '\t': rOStream << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    rOStream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    rOStream << c;
+                }
+        }
+    }
+    rOStream << '"';
+}
+
+void WriteMetadataEvent(
+    std::ostream& rOStream,
+    const std::string& rName,
+    const int ProcessId,
+    const int ThreadId,
+    const std::string& rValue)
+{
+    rOStream << "{\"name\":\"" << rName << "\",\"ph\":\"M\",\"pid\":" << ProcessId << ",\"tid\":" << ThreadId << ",\"args\":{\"name\":";
+    WriteJsonString(rOStream, rValue);
+    rOStream << "}}";
+}
+
+} // anonymous namespace
+
+Tracer::Scope::Scope(
+    Tracer& rTracer,
+    const std::string& rName,
+    const std::string& rCategory,
+    const std::string& rIdentifier)
+{
+    if (rTracer.IsEnabled()) {
+        mpTracer = &rTracer;
+        mName = rName;
+        mCategory = rCategory;
+        mIdentifier = rIdentifier;
+        mStartTime = ClockType::now();
+    }
+}
+
+Tracer::Scope::~Scope()
+{
+    if (mpTracer) {
+        // not throwing from the destructor, this would terminate the program
+        try {
+            mpTracer->AddEvent(mName, mCategory, mIdentifier, mStartTime, ClockType::now());
+        } catch (...) {}
+    }
+}
+
+Tracer::Tracer(
+    const bool IsEnabled,
+    const std::string& rProcessName)
+    : mIsEnabled(IsEnabled),
+      mProcessName(rProcessName),
+      mProcessId(static_cast<int>(std::hash<std::string>()(rProcessName) % 1000000))
+{}
+
+void Tracer::AddEvent(
+    const std::string& rName,
+    const std::string& rCategory,
+    const std::string& rIdentifier,
+    const ClockType::time_point StartTime,
+    const ClockType::time_point EndTime)
+{
+    CO_SIM_IO_TRY
+
+    if (!mIsEnabled) {return;}
+
+    Event event;
+    event.Name = rName;
+    event.Category = rCategory;
+    event.Identifier = rIdentifier;
+    event.ThreadId = std::this_thread::get_id();
+    event.StartTime = ToNanoseconds(StartTime.time_since_epoch());
+    event.Duration = std::max<std::int64_t>(0, ToNanoseconds(EndTime-StartTime)); // the wall clock can be adjusted
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+    mEvents.push_back(std::move(event));
+
+    CO_SIM_IO_CATCH
+}
+
+void Tracer::Clear()
+{
+    const std::lock_guard<std::mutex> lock(mMutex);
+    mEvents.clear();
+}
+
+std::size_t Tracer::NumEvents() const
+{
+    const std::lock_guard<std::mutex> lock(mMutex);
+    return mEvents.size();
+}
+
+std::string Tracer::GetEventsJson(const int Rank) const
+{
+    CO_SIM_IO_TRY
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    // the threads are numbered in the order in which they recorded their first event
+    std::vector<std::thread::id> thread_ids;
+    auto get_thread_index = [&thread_ids](const std::thread::id ThreadId){
+        const auto it = std::find(thread_ids.begin(), thread_ids.end(), ThreadId);
+        if (it != thread_ids.end()) {return static_cast<int>(it-thread_ids.begin());}
+        thread_ids.push_back(ThreadId);
+        return static_cast<int>(thread_ids.size()-1);
+    };
+
+    std::stringstream events;
+    for (const auto& r_event : mEvents) {
+        const int thread_id = Rank*THREADS_PER_RANK + get_thread_index(r_event.ThreadId);
+
+        if (events.tellp() > 0) {events << ",\n";}
+        events << "{\"name\":";
+        WriteJsonString(events, r_event.Name);
+        events << ",\"cat\":";
+        WriteJsonString(events, r_event.Category);
+        events << ",\"ph\":\"X\",\"ts\":";
+        WriteMicroseconds(events, r_event.StartTime);
+        events << ",\"dur\":";
+        WriteMicroseconds(events, r_event.Duration);
+        events << ",\"pid\":" << mProcessId << ",\"tid\":" << thread_id;
+        if (!r_event.Identifier.empty()) {
+            events << ",\"args\":{\"identifier\":";
+            WriteJsonString(events, r_event.Identifier);
+            events << "}";
+        }
+        events << "}";
+    }
+
+    for (std::size_t i=0; i<thread_ids.size(); ++i) {
+        if (events.tellp() > 0) {events << ",\n";}
+        std::string thread_name = "rank " + std::to_string(Rank);
+        if (i > 0) {thread_name += " (thread " + std::to_string(i) + ")";}
+        WriteMetadataEvent(events, "thread_name", mProcessId, Rank*THREADS_PER_RANK + static_cast<int>(i), thread_name);
+    }
+
+    return events.str();
+
+    CO_SIM_IO_CATCH
+}
+
+void Tracer::WriteChromeTrace(
+    const fs::path& rFileName,
+    const std::vector<std::string>& rEventsJsonOfRanks) const
+{
+    CO_SIM_IO_TRY
+
+    std::ofstream output_file(rFileName.string());
+    CO_SIM_IO_ERROR_IF_NOT(output_file.is_open()) << "Trace file " << rFileName << " could not be opened!" << std::endl;
+
+    output_file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    WriteMetadataEvent(output_file, "process_name", mProcessId, 0, mProcessName);
+
+    for (const auto& r_events : rEventsJsonOfRanks) {
+        if (!r_events.empty()) {
+            output_file << ",\n" << r_events;
+        }
+    }
+
+    output_file << "\n]}\n";
+
+    CO_SIM_IO_ERROR_IF_NOT(output_file.good()) << "Trace file " << rFileName << " could not be written!" << std::endl;
+
+    CO_SIM_IO_CATCH
+}
+
+} // namespace Internals
+} // namespace CoSimIO
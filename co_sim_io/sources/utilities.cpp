@@ -21,9 +21,95 @@
 // Project includes
 #include "includes/utilities.hpp"
 
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+// for waiting on changes in the filesystem
+#include <cerrno>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 namespace CoSimIO {
 namespace Utilities {
 
+namespace {
+
+bool PathHasState(const fs::path& rPath, const bool Exists)
+{
+    std::error_code ec;
+    return fs::exists(rPath, ec) == Exists;
+}
+
+// fallback if no notifications from the filesystem are available
+// starts with short sleeps for low latency and increases them to not flood the (possibly shared) filesystem with requests
+void WaitForPathStateWithBackoff(const fs::path& rPath, const bool Exists)
+{
+    std::size_t sleep_time = 10; // microseconds
+    while (!PathHasState(rPath, Exists)) {
+        std::this_thread::sleep_for(std::chrono::microseconds(sleep_time));
+        if (sleep_time < 10000) {sleep_time *= 2;}
+    }
+}
+
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+// waits for changes in the parent directory using inotify, instead of continuously checking the path
+// returns false if inotify cannot be used, e.g. because the limit of watches is reached
+// Note: changes done by other machines on network filesystems (e.g. NFS) are not notified,
+// hence the path is also checked periodically (with increasing intervals)
+bool WaitForPathStateWithInotify(const fs::path& rPath, const bool Exists)
+{
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    const fs::path dir = rPath.has_parent_path() ? rPath.parent_path() : fs::path(".");
+    if (inotify_add_watch(fd, dir.c_str(), IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM | IN_DELETE_SELF) < 0) {
+        close(fd);
+        return false;
+    }
+
+    // the state has to be checked after adding the watch, otherwise changes in between could be missed
+    int timeout = 1; // milliseconds
+    char events_buffer[4096];
+    while (!PathHasState(rPath, Exists)) {
+        pollfd poll_fd {fd, POLLIN, 0};
+        const int poll_result = poll(&poll_fd, 1, timeout);
+        if (poll_result < 0 && errno != EINTR) {
+            close(fd);
+            return false;
+        }
+
+        if (poll_result > 0) {
+            // the events are not evaluated, the path is checked directly. Hence only the queue is emptied
+            while (read(fd, events_buffer, sizeof(events_buffer)) > 0) {}
+        } else if (timeout < 50) {
+            timeout *= 2;
+        }
+    }
+
+    close(fd);
+    return true;
+}
+#endif
+
+void WaitForPathState(const fs::path& rPath, const bool Exists)
+{
+    if (PathHasState(rPath, Exists)) {
+        return;
+    }
+
+    #ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    if (WaitForPathStateWithInotify(rPath, Exists)) {
+        return;
+    }
+    #endif
+
+    WaitForPathStateWithBackoff(rPath, Exists);
+}
+
+} // anonymous namespace
+
 // Create the name for the connection
 // In a function bcs maybe in the future this will
 // need to be more elaborate
@@ -190,8 +276,12 @@ std::string GetElementName(const ElementType I_ElementType)
 
 void WaitUntilPathExists(const fs::path& rPath)
 {
-    std::error_code ec;
-    while(!fs::exists(rPath, ec)) {std::this_thread::sleep_for(std::chrono::microseconds(10));} // wait 0.005s before next check
+    WaitForPathState(rPath, true);
+}
+
+void WaitUntilPathIsRemoved(const fs::path& rPath)
+{
+    WaitForPathState(rPath, false);
 }
 
 std::set<std::size_t> ComputePartnerRanksAsImporter(
@@ -60,6 +60,16 @@ MPI_TEST_CASE("MPIDataCommunicator_CommRetrieval", 4)
     CHECK_EQ(MPIDataCommunicator::GetMPICommunicator(mpi_world_communicator), MPI_COMM_WORLD);
     CHECK_NE(MPIDataCommunicator::GetMPICommunicator(mpi_world_communicator), MPI_COMM_SELF);
 }
+
+MPI_TEST_CASE("MPIDataCommunicator_IsThreadSafe", 4)
+{
+    MPIDataCommunicator mpi_world_communicator(MPI_COMM_WORLD);
+
+    int provided;
+    MPI_Query_thread(&provided);
+
+    CHECK_EQ(mpi_world_communicator.IsThreadSafe(), provided == MPI_THREAD_MULTIPLE);
+}
 /*
 
 // Sum ////////////////////////////////////////////////////////////////////////
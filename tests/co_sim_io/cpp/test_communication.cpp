@@ -16,6 +16,10 @@
 #include <tuple>
 #include <array>
 #include <numeric>
+#include <complex>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
 
 // Project includes
 #include "co_sim_io_testing.hpp"
@@ -276,6 +280,148 @@ void ExportDataHelper(
     CHECK_UNARY_FALSE(ret_info_disconnect.Get<bool>("is_connected"));
 }
 
+void ExportDataBatchHelper(
+    CoSimIO::Info settings,
+    const std::vector<std::vector<double>>& DataToExport,
+    const std::size_t NumBatches)
+{
+    settings.Set<std::string>("my_name", "thread");
+    settings.Set<std::string>("connect_to", "main");
+    settings.Set<bool>("is_primary_connection", false);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    // the secondary thread should wait a bit until the primary has created the folder!
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    CoSimIO::Info connect_info;
+    CoSimIO::Info ret_info_connect = p_comm->Connect(connect_info);
+
+    CHECK_UNARY(ret_info_connect.Get<bool>("is_connected"));
+
+    CoSimIO::Info export_info;
+    export_info.Set<std::string>("identifier", "data_batch_exchange");
+
+    std::vector<std::unique_ptr<CoSimIO::Internals::DataContainerStdVectorReadOnly<double>>> data_containers;
+    Communication::ConstDataBatchType data_batch;
+    for (std::size_t i=0; i<DataToExport.size(); ++i) {
+        data_containers.emplace_back(CoSimIO::make_unique<CoSimIO::Internals::DataContainerStdVectorReadOnly<double>>(DataToExport[i]));
+        data_batch.emplace_back("field_" + std::to_string(i), data_containers.back().get());
+    }
+
+    for (std::size_t i=0; i<NumBatches; ++i) {
+        p_comm->ExportDataBatch(export_info, data_batch);
+    }
+
+    CoSimIO::Info disconnect_info;
+    CoSimIO::Info ret_info_disconnect = p_comm->Disconnect(disconnect_info);
+
+    CHECK_UNARY_FALSE(ret_info_disconnect.Get<bool>("is_connected"));
+}
+
+template<typename TDataType>
+void ImportAndCheckTypedData(
+    CoSimIO::Internals::Communication& rComm,
+    const std::string& rIdentifier,
+    const std::vector<TDataType>& rExpectedData)
+{
+    CoSimIO::Info import_info;
+    import_info.Set<std::string>("identifier", rIdentifier);
+    std::vector<TDataType> data(3); // size is different on purpose
+    CoSimIO::Internals::DataContainerStdVector<TDataType> data_container(data);
+    const CoSimIO::Info ret_info = rComm.ImportData(import_info, data_container);
+
+    CHECK_EQ(ret_info.Get<std::size_t>("memory_usage_ipc"), rExpectedData.size()*sizeof(TDataType));
+    CO_SIM_IO_CHECK_VECTOR_EQUAL(data, rExpectedData);
+}
+
+template<typename TDataType>
+void ExportTypedData(
+    CoSimIO::Internals::Communication& rComm,
+    const std::string& rIdentifier,
+    const std::vector<TDataType>& rData)
+{
+    CoSimIO::Info export_info;
+    export_info.Set<std::string>("identifier", rIdentifier);
+    const CoSimIO::Internals::DataContainerStdVectorReadOnly<TDataType> data_container(rData);
+    rComm.ExportData(export_info, data_container);
+}
+
+void ExportTypedDataHelper(
+    CoSimIO::Info settings,
+    const std::vector<float>& rFloatData,
+    const std::vector<std::int32_t>& rInt32Data,
+    const std::vector<std::int64_t>& rInt64Data,
+    const std::vector<std::complex<double>>& rComplexData)
+{
+    settings.Set<std::string>("my_name", "thread");
+    settings.Set<std::string>("connect_to", "main");
+    settings.Set<bool>("is_primary_connection", false);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    // the secondary thread should wait a bit until the primary has created the folder!
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    CoSimIO::Info connect_info;
+    CoSimIO::Info ret_info_connect = p_comm->Connect(connect_info);
+
+    CHECK_UNARY(ret_info_connect.Get<bool>("is_connected"));
+
+    ExportTypedData(*p_comm, "float_data", rFloatData);
+    ExportTypedData(*p_comm, "int32_data", rInt32Data);
+    ExportTypedData(*p_comm, "int64_data", rInt64Data);
+    ExportTypedData(*p_comm, "complex_data", rComplexData);
+
+    CoSimIO::Info disconnect_info;
+    CoSimIO::Info ret_info_disconnect = p_comm->Disconnect(disconnect_info);
+
+    CHECK_UNARY_FALSE(ret_info_disconnect.Get<bool>("is_connected"));
+}
+
+void ExportDataAsyncHelper(
+    CoSimIO::Info settings,
+    const std::vector<std::vector<double>>& DataToExport)
+{
+    settings.Set<std::string>("my_name", "thread");
+    settings.Set<std::string>("connect_to", "main");
+    settings.Set<bool>("is_primary_connection", false);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    // the secondary thread should wait a bit until the primary has created the folder!
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    CoSimIO::Info connect_info;
+    CoSimIO::Info ret_info_connect = p_comm->Connect(connect_info);
+
+    CHECK_UNARY(ret_info_connect.Get<bool>("is_connected"));
+
+    CoSimIO::Info export_info;
+    export_info.Set<std::string>("identifier", "data_exchange");
+
+    // issuing all exports at once, they are completed in the background
+    std::vector<std::future<CoSimIO::Info>> futures;
+    for (const auto& data : DataToExport) {
+        futures.push_back(p_comm->ExportDataAsync(export_info, std::make_shared<CoSimIO::Internals::DataContainerStdVectorReadOnly<double>>(data)));
+    }
+
+    for (auto& future : futures) {
+        CHECK_UNARY(future.get().Has("elapsed_time"));
+    }
+
+    CoSimIO::Info disconnect_info;
+    CoSimIO::Info ret_info_disconnect = p_comm->Disconnect(disconnect_info);
+
+    CHECK_UNARY_FALSE(ret_info_disconnect.Get<bool>("is_connected"));
+}
+
 void ExportMeshHelper(
     CoSimIO::Info settings,
     const std::vector<std::shared_ptr<CoSimIO::ModelPart>>& ModelPartsToExport)
@@ -356,6 +502,26 @@ void RunAllCommunication(CoSimIO::Info settings)
         }
     }
 
+    SUBCASE("reserved_identifier")
+    {
+        std::thread ext_thread(ConnectDisconnect, settings);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        // the suffix is used for the transfer of the coordinates of a mesh, which would be mixed up with the data
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "interface_mesh_update");
+        std::vector<double> data;
+        CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+        CHECK_THROWS_WITH(p_comm->ImportData(import_info, data_container), doctest::Contains("Identifiers must not end with \"_mesh_update\", it is reserved for internal use! Identifier: \"interface_mesh_update\""));
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
     SUBCASE("import_export_info_once")
     {
         std::thread ext_thread(ExportInfoHelper, settings, 1);
@@ -463,6 +629,153 @@ void RunAllCommunication(CoSimIO::Info settings)
             CO_SIM_IO_CHECK_VECTOR_NEAR(data_container, exp_data[i]);
         }
 
+        // all imports are recorded in the statistics
+        const CoSimIO::Info statistics = p_comm->GetStatistics().Get<CoSimIO::Info>("import_data").Get<CoSimIO::Info>("data_exchange");
+        CHECK_EQ(statistics.Get<int>("count"), static_cast<int>(exp_data.size()));
+        CHECK_GT(statistics.Get<double>("memory_usage_ipc"), 0.0);
+        const CoSimIO::Info elapsed_time = statistics.Get<CoSimIO::Info>("elapsed_time");
+        CHECK_LE(elapsed_time.Get<double>("min"), elapsed_time.Get<double>("p50"));
+        CHECK_LE(elapsed_time.Get<double>("p50"), elapsed_time.Get<double>("p99"));
+        CHECK_LE(elapsed_time.Get<double>("p99"), elapsed_time.Get<double>("max"));
+        CHECK_LE(elapsed_time.Get<double>("max"), elapsed_time.Get<double>("total"));
+
+        CoSimIO::Info disconnect_info;
+        const CoSimIO::Info ret_info_disconnect = p_comm->Disconnect(disconnect_info);
+        CHECK_EQ(ret_info_disconnect.Get<CoSimIO::Info>("statistics").Get<CoSimIO::Info>("import_data").Get<CoSimIO::Info>("data_exchange").Get<int>("count"), static_cast<int>(exp_data.size()));
+
+        ext_thread.join();
+    }
+
+    SUBCASE("import_export_data_batch")
+    {
+        std::vector<std::vector<double>> exp_data {
+            {1.1, -6.1, 535.789, 5487},
+            {},
+            {-11.56},
+            std::vector<double>(50000)
+        };
+        for (std::size_t i=0; i<exp_data[3].size(); ++i) {
+            exp_data[3][i] = 0.5*i;
+        }
+
+        const std::size_t num_batches = 3;
+        std::thread ext_thread(ExportDataBatchHelper, settings, exp_data, num_batches);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        std::vector<std::vector<double>> data(exp_data.size(), std::vector<double>(2, 1.0)); // sizes are different on purpose
+        std::vector<std::unique_ptr<CoSimIO::Internals::DataContainerStdVector<double>>> data_containers;
+        CoSimIO::Internals::Communication::DataBatchType data_batch;
+        for (std::size_t i=0; i<data.size(); ++i) {
+            data_containers.emplace_back(CoSimIO::make_unique<CoSimIO::Internals::DataContainerStdVector<double>>(data[i]));
+            data_batch.emplace_back("field_" + std::to_string(i), data_containers.back().get());
+        }
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_batch_exchange");
+        for (std::size_t i=0; i<num_batches; ++i) {
+            CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+            const CoSimIO::Info ret_info = p_comm->ImportDataBatch(import_info, data_batch);
+            const std::size_t exp_memory_usage = (exp_data[0].size()+exp_data[2].size()+exp_data[3].size())*sizeof(double);
+            if (settings.Get<std::string>("compression", "none") == "none") {
+                CHECK_EQ(ret_info.Get<std::size_t>("memory_usage_ipc"), exp_memory_usage);
+            } else {
+                // the last field is smooth, hence it compresses well
+                CHECK_LT(ret_info.Get<std::size_t>("memory_usage_ipc"), exp_memory_usage/2);
+            }
+            for (std::size_t j=0; j<data.size(); ++j) {
+                CAPTURE(j);
+                CO_SIM_IO_CHECK_VECTOR_NEAR(data[j], exp_data[j]);
+            }
+        }
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
+    SUBCASE("import_export_typed_data")
+    {
+        const std::vector<float> exp_float_data {1.5f, -6.25f, 535.75f};
+        const std::vector<std::int32_t> exp_int32_data {1, -6, 2147483647, 0, 15};
+        const std::vector<std::int64_t> exp_int64_data {9223372036854775807LL, -42};
+        const std::vector<std::complex<double>> exp_complex_data {{1.1, -2.2}, {0.0, 3.5}, {-7.25, 0.0}, {4.0, 4.0}};
+
+        std::thread ext_thread(ExportTypedDataHelper, settings, exp_float_data, exp_int32_data, exp_int64_data, exp_complex_data);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        ImportAndCheckTypedData(*p_comm, "float_data", exp_float_data);
+        ImportAndCheckTypedData(*p_comm, "int32_data", exp_int32_data);
+        ImportAndCheckTypedData(*p_comm, "int64_data", exp_int64_data);
+        ImportAndCheckTypedData(*p_comm, "complex_data", exp_complex_data);
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
+    SUBCASE("import_export_data_async")
+    {
+        const std::vector<std::vector<double>> exp_data {
+            {1.1, -6.1, 535.789, 5487},
+            {1.2, -6.01, 552.789, 5477, 1.0, -6.19, -655.789, 91.5888867},
+            {},
+            {-11.56}
+        };
+        std::thread ext_thread(ExportDataHelper, settings, exp_data);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        std::vector<std::vector<double>> data(exp_data.size());
+        std::vector<std::future<CoSimIO::Info>> futures;
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_exchange");
+        for (std::size_t i=0; i<exp_data.size(); ++i) {
+            futures.push_back(p_comm->ImportDataAsync(import_info, std::make_shared<CoSimIO::Internals::DataContainerStdVector<double>>(data[i])));
+        }
+
+        for (std::size_t i=0; i<exp_data.size(); ++i) {
+            CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+            CHECK_UNARY(futures[i].get().Has("elapsed_time"));
+            CO_SIM_IO_CHECK_VECTOR_NEAR(data[i], exp_data[i]);
+        }
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
+    SUBCASE("export_async_import_data")
+    {
+        const std::vector<std::vector<double>> exp_data {
+            {1.3, -6.001, -655.789, 91.567},
+            {1.4, -6.0001, 551.789, 5647, -1.0, 44.5, -876.123, -6.1, -63455.789, 91.567},
+            {-11.56}
+        };
+        std::thread ext_thread(ExportDataAsyncHelper, settings, exp_data);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        std::vector<double> data;
+        CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_exchange");
+        for (std::size_t i=0; i<exp_data.size(); ++i) {
+            CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+            p_comm->ImportData(import_info, data_container);
+            CO_SIM_IO_CHECK_VECTOR_NEAR(data_container, exp_data[i]);
+        }
+
         CoSimIO::Info disconnect_info;
         p_comm->Disconnect(disconnect_info);
 
@@ -473,6 +786,8 @@ void RunAllCommunication(CoSimIO::Info settings)
     {
         // this test is especially for the pipe communication,
         // as there we need to send the data in batches
+        // and for the socket communication with multiple streams,
+        // as there the data is striped across the streams
 
         std::vector<std::vector<double>> exp_data {{ }};
 
@@ -556,6 +871,158 @@ void RunAllCommunication(CoSimIO::Info settings)
         ext_thread.join();
     }
 
+    SUBCASE("import_export_moving_mesh")
+    {
+        // the same mesh is exported several times with changing coordinates,
+        // with the incremental mesh export only the coordinates are transferred if the topology did not change
+
+        auto move_nodes = [](CoSimIO::ModelPart& rModelPart, const double Offset){
+            for (auto it_node = rModelPart.NodesBegin(); it_node != rModelPart.NodesEnd(); ++it_node) {
+                (*it_node)->SetCoordinates((*it_node)->X()+Offset, (*it_node)->Y()-Offset, (*it_node)->Z()+2*Offset);
+            }
+        };
+
+        const std::vector<std::shared_ptr<CoSimIO::ModelPart>> model_parts {
+            CreateLinesModelPart(),
+            CreateLinesModelPart(),
+            CreateLinesModelPart(),
+            CreateLinesModelPart(),
+            CreateLinesModelPart(),
+            CreateLinesModelPart()
+        };
+
+        move_nodes(*model_parts[1], 0.5);
+        move_nodes(*model_parts[2], 1.5);
+        model_parts[3]->CreateNewNode(1000, 1.0, 2.0, 3.0); // changes the topology
+        model_parts[4]->CreateNewNode(1000, 1.0, 2.0, 3.0);
+        move_nodes(*model_parts[4], -0.25);
+        model_parts[5]->CreateNewNode(1000, 1.0, 2.0, 3.0); // same as the previous mesh
+        move_nodes(*model_parts[5], -0.25);
+
+        std::vector<std::string> exp_mesh_transfers {"full", "coordinates", "coordinates", "full", "coordinates", "coordinates"};
+        if (settings.Get<bool>("use_mesh_cache", false)) {
+            exp_mesh_transfers[5] = "cached";
+        }
+
+        std::thread ext_thread(ExportMeshHelper, settings, model_parts);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "test_mesh_exchange");
+
+        // the mesh is always imported into the same ModelPart, as this is required by the incremental mesh export
+        CoSimIO::ModelPart imported_model_part(model_parts[0]->Name());
+        for (std::size_t i=0; i<model_parts.size(); ++i) {
+            CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+            const CoSimIO::Info ret_info = p_comm->ImportMesh(import_info, imported_model_part);
+            CheckModelPartsAreEqual(*model_parts[i], imported_model_part);
+            if (settings.Get<bool>("use_incremental_mesh_export", false)) {
+                CHECK_EQ(ret_info.Get<std::string>("mesh_transfer"), exp_mesh_transfers[i]);
+            }
+        }
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
+    if (settings.Get<bool>("use_incremental_mesh_export", false) && !settings.Get<bool>("use_mesh_cache", false)) {
+        SUBCASE("import_export_moving_mesh_different_topology")
+        {
+            // only the coordinates are transferred for the second mesh, but it is imported into
+            // a ModelPart with the same number of nodes and a different topology, which must be detected
+
+            const std::vector<std::shared_ptr<CoSimIO::ModelPart>> model_parts {
+                CreateLinesModelPart(),
+                CreateLinesModelPart()
+            };
+
+            std::thread ext_thread(ExportMeshHelper, settings, model_parts);
+
+            CoSimIO::Info connect_info;
+            p_comm->Connect(connect_info);
+
+            CoSimIO::Info import_info;
+            import_info.Set<std::string>("identifier", "test_mesh_exchange");
+
+            CoSimIO::ModelPart imported_model_part(model_parts[0]->Name());
+            p_comm->ImportMesh(import_info, imported_model_part);
+            CheckModelPartsAreEqual(*model_parts[0], imported_model_part);
+
+            CoSimIO::ModelPart other_model_part(model_parts[0]->Name());
+            for (const auto& r_node : model_parts[0]->Nodes()) {
+                other_model_part.CreateNewNode(r_node.Id()+1, r_node.X(), r_node.Y(), r_node.Z());
+            }
+
+            CHECK_THROWS_WITH(p_comm->ImportMesh(import_info, other_model_part), doctest::Contains("The topology of ModelPart \"line_model_part\" does not match the topology of the exported mesh!"));
+
+            CoSimIO::Info disconnect_info;
+            p_comm->Disconnect(disconnect_info);
+
+            ext_thread.join();
+        }
+    }
+
+    if (settings.Get<bool>("use_mesh_cache", false)) {
+        SUBCASE("import_export_mesh_cache")
+        {
+            // the same mesh is exported several times, it is only transferred if the importer did not receive it already
+            // the importer does not keep a copy of the mesh, hence importing a cached mesh into a different or modified ModelPart fails
+
+            const std::vector<std::shared_ptr<CoSimIO::ModelPart>> model_parts {
+                CreateLinesModelPart(),
+                CreateLinesModelPart(),
+                CreateLinesModelPart(),
+                CreateLinesModelPart(),
+                CreateLinesModelPart(),
+                CreateLinesModelPart()
+            };
+
+            model_parts[5]->CreateNewNode(1000, 1.0, 2.0, 3.0);
+
+            const std::vector<std::string> exp_mesh_transfers {"full", "cached", "cached", "cached", "cached", "full"};
+
+            std::thread ext_thread(ExportMeshHelper, settings, model_parts);
+
+            CoSimIO::Info connect_info;
+            p_comm->Connect(connect_info);
+
+            CoSimIO::Info import_info;
+            import_info.Set<std::string>("identifier", "test_mesh_exchange");
+
+            CoSimIO::ModelPart imported_model_part(model_parts[0]->Name());
+            CoSimIO::ModelPart other_imported_model_part(model_parts[0]->Name());
+            for (std::size_t i=0; i<model_parts.size(); ++i) {
+                CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+
+                if (i==2) {
+                    // a different ModelPart does not have the mesh
+                    CHECK_THROWS_WITH(p_comm->ImportMesh(import_info, other_imported_model_part), doctest::Contains("ModelPart \"line_model_part\" does not contain the mesh \"test_mesh_exchange\" that is in the mesh cache!"));
+                    continue;
+                }
+                if (i==3) {
+                    // the importer modified its mesh
+                    imported_model_part.GetNode(1).SetCoordinates(-1.0, -2.0, -3.0);
+                    CHECK_THROWS_WITH(p_comm->ImportMesh(import_info, imported_model_part), doctest::Contains("ModelPart \"line_model_part\" does not contain the mesh \"test_mesh_exchange\" that is in the mesh cache!"));
+                    imported_model_part.GetNode(1).SetCoordinates(model_parts[0]->GetNode(1).Coordinates());
+                    continue;
+                }
+
+                const CoSimIO::Info ret_info = p_comm->ImportMesh(import_info, imported_model_part);
+                CheckModelPartsAreEqual(*model_parts[i], imported_model_part);
+                CHECK_EQ(ret_info.Get<std::string>("mesh_transfer"), exp_mesh_transfers[i]);
+            }
+
+            CoSimIO::Info disconnect_info;
+            p_comm->Disconnect(disconnect_info);
+
+            ext_thread.join();
+        }
+    }
+
     SUBCASE("import_export_large_mesh")
     {
         // this test is especially for the pipe communication,
@@ -624,6 +1091,209 @@ TEST_CASE("FileCommunication_avail_file" * doctest::timeout(250))
     RunAllCommunication(settings);
 }
 
+TEST_CASE("FileCommunication_file_queue" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_file_queue", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_file_queue_not_file_serializer" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_file_serializer", false);
+    settings.Set<bool>("use_file_queue", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_memory_mapped_files" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_memory_mapped_files", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_memory_mapped_files_not_file_serializer" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_memory_mapped_files", true);
+    settings.Set<bool>("use_file_serializer", false);
+    settings.Set<bool>("use_file_queue", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_memory_mapped_files_partner_uses_streams" * doctest::timeout(250))
+{
+    // the files have the same layout, hence the partners can use different settings
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+    settings.Set<int>("echo_level", 0);
+
+    CoSimIO::Info settings_partner(settings);
+    settings.Set<bool>("use_memory_mapped_files", true);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    const std::vector<std::vector<double>> exp_data {{1.0, -2.5, 3.75}, {}, {1e10}};
+
+    std::thread ext_thread(ExportDataHelper, settings_partner, exp_data);
+
+    CoSimIO::Info connect_info;
+    p_comm->Connect(connect_info);
+
+    CoSimIO::Info import_info;
+    import_info.Set<std::string>("identifier", "data_exchange");
+
+    for (const auto& r_exp_data : exp_data) {
+        std::vector<double> data(5, 0.0); // size is different on purpose
+        CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+        p_comm->ImportData(import_info, data_container);
+        CO_SIM_IO_CHECK_VECTOR_NEAR(data_container, r_exp_data);
+    }
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+
+    ext_thread.join();
+}
+
+TEST_CASE("FileCommunication_incremental_mesh_export" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_incremental_mesh_export", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_fpc_compression" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<std::string>("compression", "fpc");
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_fpc_compression" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<std::string>("compression", "fpc");
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_typed_data_type_mismatch" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    // the partner exports float data, which cannot be imported as int32 data
+    std::thread ext_thread(ExportTypedDataHelper, settings, std::vector<float>{1.5f, 2.5f}, std::vector<std::int32_t>(), std::vector<std::int64_t>(), std::vector<std::complex<double>>());
+
+    CoSimIO::Info connect_info;
+    p_comm->Connect(connect_info);
+
+    CoSimIO::Info import_info;
+    import_info.Set<std::string>("identifier", "float_data");
+    std::vector<std::int32_t> data;
+    CoSimIO::Internals::DataContainerStdVector<std::int32_t> data_container(data);
+
+    std::string error_message;
+    try {
+        p_comm->ImportData(import_info, data_container);
+    } catch (const std::exception& e) {
+        error_message = e.what();
+    }
+    CHECK_NE(error_message.find("Mismatch in type of received data \"float_data\"!\nExpected: int32\nReceived: float"), std::string::npos);
+
+    // consuming the remaining data of the partner
+    ImportAndCheckTypedData(*p_comm, "int32_data", std::vector<std::int32_t>());
+    ImportAndCheckTypedData(*p_comm, "int64_data", std::vector<std::int64_t>());
+    ImportAndCheckTypedData(*p_comm, "complex_data", std::vector<std::complex<double>>());
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+
+    ext_thread.join();
+}
+
+TEST_CASE("FileCommunication_trace" * doctest::timeout(250))
+{
+    auto read_file = [](const fs::path& rFileName){
+        std::stringstream buffer;
+        {
+            std::ifstream input_file(rFileName.string());
+            buffer << input_file.rdbuf();
+        }
+        fs::remove(rFileName);
+        return buffer.str();
+    };
+
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+    settings.Set<int>("echo_level", 0);
+
+    CoSimIO::Info settings_partner(settings);
+    settings.Set<std::string>("trace_file", "co_sim_io_test_trace_main.json");
+    settings_partner.Set<std::string>("trace_file", "co_sim_io_test_trace_thread.json");
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    std::thread ext_thread(ExportDataHelper, settings_partner, std::vector<std::vector<double>>{{1.0, 2.0}, {3.0}});
+
+    CoSimIO::Info connect_info;
+    p_comm->Connect(connect_info);
+
+    CoSimIO::Info import_info;
+    import_info.Set<std::string>("identifier", "data_exchange");
+    std::vector<double> data;
+    CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+    p_comm->ImportData(import_info, data_container);
+    p_comm->ImportData(import_info, data_container);
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+
+    ext_thread.join();
+
+    REQUIRE_UNARY(fs::exists("co_sim_io_test_trace_main.json"));
+    REQUIRE_UNARY(fs::exists("co_sim_io_test_trace_thread.json"));
+
+    const std::string trace_main = read_file("co_sim_io_test_trace_main.json");
+    const std::string trace_thread = read_file("co_sim_io_test_trace_thread.json");
+
+    for (const std::string r_name : {"connect", "handshake", "synchronize_all", "ipc", "disconnect"}) {
+        CHECK_MESSAGE(trace_main.find("\"name\":\"" + r_name + "\"") != std::string::npos, "Missing event: " << r_name);
+        CHECK_MESSAGE(trace_thread.find("\"name\":\"" + r_name + "\"") != std::string::npos, "Missing event: " << r_name);
+    }
+
+    CHECK_NE(trace_main.find("\"name\":\"import_data\",\"cat\":\"operation\""), std::string::npos);
+    CHECK_NE(trace_main.find("\"args\":{\"identifier\":\"data_exchange\"}"), std::string::npos);
+    CHECK_NE(trace_main.find("\"args\":{\"name\":\"main\"}"), std::string::npos);
+    CHECK_EQ(trace_main.find("\"name\":\"export_data\""), std::string::npos);
+
+    CHECK_NE(trace_thread.find("\"name\":\"export_data\",\"cat\":\"operation\""), std::string::npos);
+    CHECK_NE(trace_thread.find("\"args\":{\"name\":\"thread\"}"), std::string::npos);
+}
+
 TEST_CASE("PipeCommunication" * doctest::timeout(250))
 {
     CoSimIO::Info settings;
@@ -643,6 +1313,116 @@ TEST_CASE("PipeCommunication_serializer_data" * doctest::timeout(250))
 #endif
 }
 
+TEST_CASE("PipeCommunication_vmsplice" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "pipe");
+    settings.Set<bool>("use_vmsplice", true);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // pipe comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // pipe comm is currenlty not implemented in Win
+TEST_CASE("PipeCommunication_vmsplice_negotiation" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "pipe");
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+    settings.Set<int>("echo_level", 0);
+    settings.Set<bool>("use_vmsplice", true);
+
+    // large enough to be spliced
+    std::vector<double> large_data(100000);
+    std::iota(large_data.begin(), large_data.end(), 0.5);
+    const std::vector<std::vector<double>> exp_data {large_data, {1.0, 2.0}, large_data};
+
+    auto run = [&](const CoSimIO::Info& rPartnerSettings, const bool ExpectVmsplice){
+        using Communication = CoSimIO::Internals::Communication;
+        std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+        std::thread ext_thread(ExportDataHelper, rPartnerSettings, exp_data);
+
+        CoSimIO::Info connect_info;
+        const CoSimIO::Info ret_info = p_comm->Connect(connect_info);
+        CHECK_EQ(ret_info.Get<bool>("use_vmsplice"), ExpectVmsplice);
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_exchange");
+
+        for (const auto& r_exp_data : exp_data) {
+            std::vector<double> data;
+            CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+            p_comm->ImportData(import_info, data_container);
+            CO_SIM_IO_CHECK_VECTOR_NEAR(data_container, r_exp_data);
+        }
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    };
+
+    SUBCASE("both_partners_use_vmsplice")
+    {
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+        run(settings, true);
+#else
+        run(settings, false); // only available in Linux
+#endif
+    }
+
+    SUBCASE("partner_does_not_use_vmsplice")
+    {
+        CoSimIO::Info settings_partner(settings);
+        settings_partner.Set<bool>("use_vmsplice", false);
+        run(settings_partner, false);
+    }
+}
+#endif
+
+TEST_CASE("SharedMemoryCommunication" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "shared_memory");
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // shared memory comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+TEST_CASE("SharedMemoryCommunication_mesh_cache" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "shared_memory");
+    settings.Set<bool>("use_mesh_cache", true);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // shared memory comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+TEST_CASE("SharedMemoryCommunication_small_buffer" * doctest::timeout(250))
+{
+    // buffer is smaller than the data that is exchanged in the tests, hence checks the wrap-around
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "shared_memory");
+    settings.Set<std::size_t>("buffer_size", 1024);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // shared memory comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+TEST_CASE("SharedMemoryCommunication_serializer_data" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "shared_memory");
+    settings.Set<bool>("use_serializer_for_data", true);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // shared memory comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
 TEST_CASE("LocalSocketCommunication" * doctest::timeout(250))
 {
     CoSimIO::Info settings;
@@ -669,6 +1449,92 @@ TEST_CASE("SocketCommunication" * doctest::timeout(250))
     RunAllCommunication(settings);
 }
 
+TEST_CASE("SocketCommunication_incremental_mesh_export" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("use_incremental_mesh_export", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_mesh_cache_ascii" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("use_mesh_cache", true);
+    settings.Set<std::string>("serializer_trace_type", "ascii");
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_mesh_cache_incremental_mesh_export" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("use_mesh_cache", true);
+    settings.Set<bool>("use_incremental_mesh_export", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_multiple_streams" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<int>("num_streams", 3);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_multiple_streams_serializer_data" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<int>("num_streams", 4);
+    settings.Set<bool>("use_serializer_for_data", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_socket_options" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("tcp_no_delay", true);
+    settings.Set<bool>("quick_ack", true);
+    settings.Set<int>("send_buffer_size", 1<<20);
+    settings.Set<int>("receive_buffer_size", 1<<20);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_effective_socket_options" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("tcp_no_delay", true);
+    settings.Set<int>("receive_buffer_size", 1<<18);
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    std::thread ext_thread(ConnectDisconnect, settings);
+
+    CoSimIO::Info connect_info;
+    const CoSimIO::Info ret_info = p_comm->Connect(connect_info);
+
+    // the values used by the OS are reported
+    REQUIRE(ret_info.Has("socket_options"));
+    const CoSimIO::Info socket_options = ret_info.Get<CoSimIO::Info>("socket_options");
+    CHECK_UNARY(socket_options.Get<bool>("tcp_no_delay"));
+    CHECK_GE(socket_options.Get<int>("receive_buffer_size"), 1<<18); // the OS might use a larger buffer
+    CHECK_GT(socket_options.Get<int>("send_buffer_size"), 0);
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+
+    ext_thread.join();
+}
+
 TEST_CASE("SocketCommunication_serializer_data" * doctest::timeout(250))
 {
     CoSimIO::Info settings;
@@ -0,0 +1,137 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+// Project includes
+#include "co_sim_io_testing.hpp"
+#include "includes/compression.hpp"
+
+
+namespace CoSimIO {
+
+namespace {
+
+// the compression is lossless, hence the values must be bitwise identical
+void CheckFpcRoundTrip(const std::vector<double>& rData)
+{
+    const std::string compressed_data = Internals::Compression::CompressFpc(rData.data(), rData.size());
+
+    std::vector<double> decompressed_data(3, 1.0); // size is different on purpose
+    Internals::DataContainerStdVector<double> data_container(decompressed_data);
+    Internals::Compression::DecompressFpc(compressed_data, data_container);
+
+    REQUIRE_EQ(decompressed_data.size(), rData.size());
+    for (std::size_t i=0; i<rData.size(); ++i) {
+        CHECK_MESSAGE(std::memcmp(&decompressed_data[i], &rData[i], sizeof(double)) == 0, "Mismatch in component: " << i);
+    }
+}
+
+} // anonymous namespace
+
+TEST_SUITE("Compression") {
+
+TEST_CASE("compression_type_to_string")
+{
+    using namespace Internals::Compression;
+
+    CHECK_EQ(StringToCompressionType("none"), CompressionType::None);
+    CHECK_EQ(StringToCompressionType("fpc"), CompressionType::Fpc);
+    CHECK_EQ(CompressionTypeToString(CompressionType::None), "none");
+    CHECK_EQ(CompressionTypeToString(CompressionType::Fpc), "fpc");
+
+    CHECK_THROWS(StringToCompressionType("lz4"));
+}
+
+TEST_CASE("fpc_empty")
+{
+    CheckFpcRoundTrip({});
+}
+
+TEST_CASE("fpc_special_values")
+{
+    CheckFpcRoundTrip({
+        0.0, -0.0, 1.0, -1.0,
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::min(),
+        std::numeric_limits<double>::denorm_min(),
+        std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::lowest()
+    });
+}
+
+TEST_CASE("fpc_smooth_data")
+{
+    // fields on the interface are usually smooth, they should compress well
+    std::vector<double> data(20000);
+    for (std::size_t i=0; i<data.size(); ++i) {
+        data[i] = 2.5*std::sin(0.001*i) + 0.001*i;
+    }
+    CheckFpcRoundTrip(data);
+
+    // constant data
+    std::vector<double> constant_data(1000, 3.25);
+    CheckFpcRoundTrip(constant_data);
+
+    const std::string compressed_data = Internals::Compression::CompressFpc(constant_data.data(), constant_data.size());
+    CHECK_LT(compressed_data.size(), constant_data.size()*sizeof(double)/10);
+}
+
+TEST_CASE("fpc_random_data")
+{
+    // random data cannot be compressed, but it must still be restored exactly
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<double> distribution(-1e10, 1e10);
+
+    std::vector<double> data(5001); // odd number of values on purpose
+    for (auto& r_value : data) {
+        r_value = distribution(generator);
+    }
+    CheckFpcRoundTrip(data);
+
+    // worst case: 4 bits of header per value
+    const std::string compressed_data = Internals::Compression::CompressFpc(data.data(), data.size());
+    CHECK_LE(compressed_data.size(), sizeof(std::uint64_t) + (data.size()+1)/2 + data.size()*sizeof(double));
+}
+
+TEST_CASE("fpc_invalid_data")
+{
+    const std::vector<double> data {1.0, 2.0, 3.0};
+    const std::string compressed_data = Internals::Compression::CompressFpc(data.data(), data.size());
+
+    std::vector<double> decompressed_data;
+    Internals::DataContainerStdVector<double> data_container(decompressed_data);
+
+    CHECK_THROWS(Internals::Compression::DecompressFpc(compressed_data.substr(0, 4), data_container));
+    CHECK_THROWS(Internals::Compression::DecompressFpc(compressed_data.substr(0, compressed_data.size()-1), data_container));
+    CHECK_THROWS(Internals::Compression::DecompressFpc(compressed_data + "x", data_container));
+
+    // the number of values is checked against the size of the compressed data before allocating the memory
+    for (const std::uint64_t invalid_size : {std::uint64_t(7), std::uint64_t(1) << 40, ~std::uint64_t(0)}) {
+        CAPTURE(invalid_size);
+        std::string invalid_data(compressed_data);
+        for (std::size_t i=0; i<sizeof(invalid_size); ++i) {
+            invalid_data[i] = static_cast<char>((invalid_size >> (8*i)) & 0xff);
+        }
+        CHECK_THROWS(Internals::Compression::DecompressFpc(invalid_data, data_container));
+    }
+}
+
+} // TEST_SUITE("Compression")
+
+} // namespace CoSimIO
@@ -38,6 +38,7 @@ TEST_CASE("DataCommunicator_InquiryChecks")
     CHECK_UNARY(serial_communicator.IsDefinedOnThisRank());
     CHECK_UNARY_FALSE(serial_communicator.IsNullOnThisRank());
     CHECK_UNARY_FALSE(serial_communicator.IsDistributed());
+    CHECK_UNARY(serial_communicator.IsThreadSafe());
 }
 
 TEST_CASE("DataCommunicator_ErrorBroadcasting")
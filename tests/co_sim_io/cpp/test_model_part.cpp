@@ -71,6 +71,30 @@ TEST_CASE("node")
     }
 }
 
+TEST_CASE("node_set_coordinates")
+{
+    const std::array<double, 3> coords = {1.0, -2.7, 9.44};
+
+    Node node(16, 0.2, -33.4, 647);
+
+    SUBCASE("from_coords")
+    {
+        node.SetCoordinates(coords[0], coords[1], coords[2]);
+    }
+
+    SUBCASE("from_coords_array")
+    {
+        node.SetCoordinates(coords);
+    }
+
+    CHECK_EQ(node.Id(), 16);
+
+    for (std::size_t i=0; i<3; ++i) {
+        CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+        CHECK_EQ(node.Coordinates()[i], doctest::Approx(coords[i]));
+    }
+}
+
 TEST_CASE("node_negative_id")
 {
     const std::array<double, 3> coords = {1.0, -2.7, 9.44};
@@ -351,6 +375,93 @@ TEST_CASE("model_part_get_node")
     }
 }
 
+TEST_CASE("model_part_get_node_consecutive_and_non_consecutive_ids")
+{
+    ModelPart model_part("for_test");
+
+    // consecutive Ids, no map needed for accessing the nodes
+    for (int i=0; i<10; ++i) {
+        model_part.CreateNewNode(5+i, i*1.0, 0,0);
+    }
+
+    for (int i=0; i<10; ++i) {
+        CHECK_EQ(model_part.GetNode(5+i).X(), doctest::Approx(i*1.0));
+    }
+    CHECK_THROWS_WITH(model_part.GetNode(4), "Error: Node with Id 4 does not exist!\n");
+    CHECK_THROWS_WITH(model_part.GetNode(15), "Error: Node with Id 15 does not exist!\n");
+    CHECK_THROWS_WITH(model_part.GetNode(-3), "Error: Node with Id -3 does not exist!\n");
+
+    // this breaks the consecutive Ids
+    model_part.CreateNewNode(100, 2.5, 0,0);
+    model_part.CreateNewNode(15, 3.5, 0,0);
+
+    CHECK_THROWS_WITH(model_part.CreateNewNode(7, 0,0,0), "Error: The Node with Id 7 exists already!\n");
+
+    REQUIRE_EQ(model_part.NumberOfNodes(), 12);
+    for (int i=0; i<10; ++i) {
+        CHECK_EQ(model_part.GetNode(5+i).X(), doctest::Approx(i*1.0));
+    }
+    CHECK_EQ(model_part.GetNode(100).X(), doctest::Approx(2.5));
+    CHECK_EQ(model_part.GetNode(15).X(), doctest::Approx(3.5));
+    CHECK_THROWS_WITH(model_part.GetNode(4), "Error: Node with Id 4 does not exist!\n");
+    CHECK_THROWS_WITH(model_part.GetNode(16), "Error: Node with Id 16 does not exist!\n");
+}
+
+TEST_CASE("model_part_nodes_remain_valid")
+{
+    ModelPart model_part("for_test");
+
+    const auto& r_first_node = model_part.CreateNewNode(1, 1.5, -2.0, 3.0);
+    const auto p_first_node = model_part.pGetNode(1);
+    model_part.CreateNewElement(1, CoSimIO::ElementType::Point3D, {1});
+
+    // creating many nodes reallocates the nodal data, the Nodes must stay valid
+    const std::size_t num_nodes = 5000;
+    std::vector<CoSimIO::IdType> ids(num_nodes);
+    std::vector<double> coords(num_nodes);
+    for (std::size_t i=0; i<num_nodes; ++i) {
+        ids[i] = static_cast<CoSimIO::IdType>(i+2);
+        coords[i] = i*0.5;
+    }
+    model_part.CreateNewNodes(ids, coords, coords, coords);
+    REQUIRE_EQ(model_part.NumberOfNodes(), num_nodes+1);
+
+    CHECK_EQ(r_first_node.Id(), 1);
+    CHECK_EQ(r_first_node.X(), doctest::Approx(1.5));
+    CHECK_EQ(&r_first_node, &(*p_first_node));
+    CHECK_EQ(model_part.GetNode(num_nodes+1).Z(), doctest::Approx((num_nodes-1)*0.5));
+
+    // the coordinates are changed for all references to the node
+    model_part.GetNode(1).SetCoordinates(7.0, 8.0, 9.0);
+    CHECK_EQ(r_first_node.X(), doctest::Approx(7.0));
+    CHECK_EQ(p_first_node->Y(), doctest::Approx(8.0));
+    CHECK_EQ((*model_part.GetElement(1).NodesBegin())->Z(), doctest::Approx(9.0));
+
+    // referenced Nodes stay alive after clearing the ModelPart
+    model_part.Clear();
+    CHECK_EQ(p_first_node->Id(), 1);
+    CHECK_EQ(p_first_node->X(), doctest::Approx(7.0));
+}
+
+TEST_CASE("model_part_nodes_outlive_model_part")
+{
+    Element::NodePointerType p_node;
+    ModelPart::ElementPointerType p_element;
+
+    {
+        ModelPart model_part("for_test");
+        model_part.CreateNewNode(3, 1.0, 2.0, 3.0);
+        model_part.CreateNewNode(4, 4.0, 5.0, 6.0);
+        model_part.CreateNewElement(1, CoSimIO::ElementType::Line2D2, {3, 4});
+        p_node = model_part.pGetNode(3);
+        p_element = model_part.pGetElement(1);
+    }
+
+    CHECK_EQ(p_node->Id(), 3);
+    CHECK_EQ(p_node->Z(), doctest::Approx(3.0));
+    CHECK_EQ((*(p_element->NodesBegin()+1))->X(), doctest::Approx(4.0));
+}
+
 TEST_CASE("model_part_range_based_loop_nodes")
 {
     ModelPart model_part("for_test");
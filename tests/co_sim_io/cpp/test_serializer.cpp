@@ -427,6 +427,46 @@ void RunAllSerializationTests(CoSimIO::Internals::Serializer& rSerializer)
         TestObjectSerializationComponentwise1D(rSerializer, object_to_be_saved, object_to_be_loaded);
     }
 
+    SUBCASE("std::vector_large_double")
+    {
+        using VectorType = std::vector<double>;
+
+        VectorType object_to_be_saved(100000);
+        VectorType object_to_be_loaded;
+
+        FillVectorWithValues(object_to_be_saved);
+
+        TestObjectSerializationComponentwise1D(rSerializer, object_to_be_saved, object_to_be_loaded);
+    }
+
+    SUBCASE("array")
+    {
+        // arrays are saved in one block, checking that this works together with other values
+        const std::vector<double> array_to_be_saved {1.5, -3.25, 2.0e5, 0.0, 7.125};
+        const std::vector<int> int_array_to_be_saved {1, -3, 200, 0};
+        std::vector<double> array_to_be_loaded(array_to_be_saved.size());
+        std::vector<int> int_array_to_be_loaded(int_array_to_be_saved.size());
+
+        rSerializer.save("before", 42);
+        rSerializer.save_array("array", array_to_be_saved.data(), array_to_be_saved.size());
+        rSerializer.save_array("empty_array", array_to_be_saved.data(), 0);
+        rSerializer.save_array("int_array", int_array_to_be_saved.data(), int_array_to_be_saved.size());
+        rSerializer.save("after", std::string("the_end"));
+
+        int before;
+        std::string after;
+        rSerializer.load("before", before);
+        rSerializer.load_array("array", array_to_be_loaded.data(), array_to_be_loaded.size());
+        rSerializer.load_array("empty_array", array_to_be_loaded.data(), 0);
+        rSerializer.load_array("int_array", int_array_to_be_loaded.data(), int_array_to_be_loaded.size());
+        rSerializer.load("after", after);
+
+        CHECK_EQ(before, 42);
+        CO_SIM_IO_CHECK_VECTOR_NEAR(array_to_be_loaded, array_to_be_saved);
+        CO_SIM_IO_CHECK_VECTOR_EQUAL(int_array_to_be_loaded, int_array_to_be_saved);
+        CHECK_EQ(after, "the_end");
+    }
+
     SUBCASE("std::map")
     {
         std::map <std::string, double> object_to_be_saved {
@@ -0,0 +1,115 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <sstream>
+
+// Project includes
+#include "co_sim_io_testing.hpp"
+#include "includes/statistics.hpp"
+
+
+namespace CoSimIO {
+
+TEST_SUITE("Statistics") {
+
+TEST_CASE("duration_histogram_empty")
+{
+    const Internals::DurationHistogram histogram;
+
+    CHECK_EQ(histogram.Count(), 0);
+    CHECK_EQ(histogram.Total(), doctest::Approx(0.0));
+    CHECK_EQ(histogram.Mean(), doctest::Approx(0.0));
+    CHECK_EQ(histogram.Percentile(0.5), doctest::Approx(0.0));
+}
+
+TEST_CASE("duration_histogram")
+{
+    Internals::DurationHistogram histogram;
+
+    // 1ms ... 100ms
+    for (int i=1; i<=100; ++i) {
+        histogram.Add(i*1e-3);
+    }
+
+    CHECK_EQ(histogram.Count(), 100);
+    CHECK_EQ(histogram.Total(), doctest::Approx(5.05));
+    CHECK_EQ(histogram.Mean(), doctest::Approx(0.0505));
+    CHECK_EQ(histogram.Min(), doctest::Approx(1e-3));
+    CHECK_EQ(histogram.Max(), doctest::Approx(0.1));
+
+    // the percentiles are accurate to the width of the bins (~9%)
+    CHECK_EQ(histogram.Percentile(0.5), doctest::Approx(0.05).epsilon(0.1));
+    CHECK_EQ(histogram.Percentile(0.99), doctest::Approx(0.099).epsilon(0.1));
+
+    // the first and last values are exact
+    CHECK_EQ(histogram.Percentile(0.0), doctest::Approx(1e-3));
+    CHECK_EQ(histogram.Percentile(1.0), doctest::Approx(0.1));
+
+    CHECK_THROWS(histogram.Percentile(1.5));
+}
+
+TEST_CASE("duration_histogram_out_of_range")
+{
+    Internals::DurationHistogram histogram;
+
+    histogram.Add(0.0);
+    histogram.Add(1e7);
+
+    CHECK_EQ(histogram.Count(), 2);
+    CHECK_EQ(histogram.Percentile(0.5), doctest::Approx(0.0));
+    CHECK_EQ(histogram.Percentile(1.0), doctest::Approx(1e7));
+}
+
+TEST_CASE("statistics")
+{
+    Internals::Statistics statistics;
+
+    Info info;
+    info.Set<double>("elapsed_time", 0.5);
+    info.Set<double>("elapsed_time_ipc", 0.25);
+    info.Set<std::size_t>("memory_usage_ipc", 100);
+
+    statistics.Record("export_data", "pressure", info);
+    statistics.Record("export_data", "pressure", info);
+    statistics.Record("export_data", "velocity", info);
+
+    info.Set<double>("elapsed_time_serializer", 0.1);
+    statistics.Record("import_mesh", "interface", info);
+
+    const Info stats_info = statistics.GetInfo();
+    CHECK_EQ(stats_info.Size(), 2);
+
+    const Info pressure = stats_info.Get<Info>("export_data").Get<Info>("pressure");
+    CHECK_EQ(pressure.Get<int>("count"), 2);
+    CHECK_EQ(pressure.Get<double>("memory_usage_ipc"), doctest::Approx(200));
+    CHECK_EQ(pressure.Get<double>("elapsed_time_ipc"), doctest::Approx(0.5));
+    CHECK_EQ(pressure.Get<double>("elapsed_time_serializer"), doctest::Approx(0.0));
+    CHECK_EQ(pressure.Get<Info>("elapsed_time").Get<double>("total"), doctest::Approx(1.0));
+    CHECK_EQ(pressure.Get<Info>("elapsed_time").Get<double>("mean"), doctest::Approx(0.5));
+    CHECK_EQ(pressure.Get<Info>("elapsed_time").Get<double>("p99"), doctest::Approx(0.5));
+
+    CHECK_EQ(stats_info.Get<Info>("export_data").Get<Info>("velocity").Get<int>("count"), 1);
+    CHECK_EQ(stats_info.Get<Info>("import_mesh").Get<Info>("interface").Get<double>("elapsed_time_serializer"), doctest::Approx(0.1));
+
+    std::stringstream output;
+    statistics.Print(output);
+    CHECK_NE(output.str().find("pressure"), std::string::npos);
+    CHECK_NE(output.str().find("import_mesh"), std::string::npos);
+
+    statistics.Clear();
+    CHECK_EQ(statistics.GetInfo().Size(), 0);
+}
+
+} // TEST_SUITE("Statistics")
+
+} // namespace CoSimIO
@@ -0,0 +1,125 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Project includes
+#include "co_sim_io_testing.hpp"
+#include "includes/tracer.hpp"
+
+
+namespace CoSimIO {
+
+TEST_SUITE("Tracer") {
+
+TEST_CASE("tracer_disabled")
+{
+    Internals::Tracer tracer(false, "solver");
+
+    {
+        const Internals::Tracer::Scope trace_scope(tracer, "export_data", "operation", "pressure");
+    }
+    tracer.AddEvent("import_data", "operation", "", Internals::Tracer::ClockType::now(), Internals::Tracer::ClockType::now());
+
+    CHECK_UNARY_FALSE(tracer.IsEnabled());
+    CHECK_EQ(tracer.NumEvents(), 0);
+    CHECK_EQ(tracer.GetEventsJson(0), "");
+}
+
+TEST_CASE("tracer_events")
+{
+    Internals::Tracer tracer(true, "solver");
+
+    {
+        const Internals::Tracer::Scope trace_scope(tracer, "export_data", "operation", "pressure");
+        const Internals::Tracer::Scope trace_scope_phase(tracer, "ipc", "phase");
+    }
+
+    const auto start_time = Internals::Tracer::ClockType::now();
+    tracer.AddEvent("import_mesh", "operation", "in\"ter\\face", start_time, start_time + std::chrono::microseconds(1500));
+
+    CHECK_UNARY(tracer.IsEnabled());
+    REQUIRE_EQ(tracer.NumEvents(), 3);
+
+    const std::string events = tracer.GetEventsJson(2);
+    CHECK_NE(events.find("\"name\":\"export_data\",\"cat\":\"operation\",\"ph\":\"X\""), std::string::npos);
+    CHECK_NE(events.find("\"args\":{\"identifier\":\"pressure\"}"), std::string::npos);
+    CHECK_NE(events.find("\"name\":\"ipc\",\"cat\":\"phase\""), std::string::npos);
+    CHECK_NE(events.find("\"dur\":1500.000,"), std::string::npos);
+    CHECK_NE(events.find("\"identifier\":\"in\\\"ter\\\\face\""), std::string::npos); // escaped
+
+    // all events were recorded by the same thread
+    CHECK_NE(events.find("\"tid\":2000"), std::string::npos);
+    CHECK_EQ(events.find("\"tid\":2001"), std::string::npos);
+    CHECK_NE(events.find("{\"name\":\"thread_name\",\"ph\":\"M\""), std::string::npos);
+    CHECK_NE(events.find("\"args\":{\"name\":\"rank 2\"}"), std::string::npos);
+
+    tracer.Clear();
+    CHECK_EQ(tracer.NumEvents(), 0);
+}
+
+TEST_CASE("tracer_threads")
+{
+    Internals::Tracer tracer(true, "solver");
+
+    {
+        const Internals::Tracer::Scope trace_scope(tracer, "import_data", "operation");
+    }
+
+    std::thread other_thread([&tracer](){
+        const Internals::Tracer::Scope trace_scope(tracer, "import_data_async", "operation");
+    });
+    other_thread.join();
+
+    // each thread is shown separately
+    const std::string events = tracer.GetEventsJson(0);
+    CHECK_NE(events.find("\"tid\":0"), std::string::npos);
+    CHECK_NE(events.find("\"tid\":1"), std::string::npos);
+    CHECK_NE(events.find("\"args\":{\"name\":\"rank 0 (thread 1)\"}"), std::string::npos);
+}
+
+TEST_CASE("tracer_write_chrome_trace")
+{
+    Internals::Tracer tracer(true, "my_solver");
+
+    {
+        const Internals::Tracer::Scope trace_scope(tracer, "connect", "connection");
+    }
+
+    const fs::path file_name("co_sim_io_test_tracer.json");
+    tracer.WriteChromeTrace(file_name, {tracer.GetEventsJson(0), "", tracer.GetEventsJson(1)});
+
+    REQUIRE_UNARY(fs::exists(file_name));
+
+    std::stringstream buffer;
+    {
+        std::ifstream input_file(file_name.string());
+        buffer << input_file.rdbuf();
+    }
+    fs::remove(file_name);
+
+    const std::string trace = buffer.str();
+    CHECK_EQ(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n{\"name\":\"process_name\""), 0);
+    CHECK_NE(trace.find("\"args\":{\"name\":\"my_solver\"}"), std::string::npos);
+    CHECK_NE(trace.find("\"tid\":1000"), std::string::npos);
+    CHECK_EQ(trace.find(",\n,"), std::string::npos); // empty events are skipped
+    CHECK_EQ(trace.substr(trace.size()-4), "\n]}\n");
+
+    CHECK_THROWS(tracer.WriteChromeTrace("non_existing_directory/trace.json", {}));
+}
+
+} // TEST_SUITE("Tracer")
+
+} // namespace CoSimIO
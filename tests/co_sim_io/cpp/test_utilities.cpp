@@ -11,6 +11,9 @@
 //
 
 // System includes
+#include <chrono>
+#include <fstream>
+#include <thread>
 
 // Project includes
 #include "co_sim_io_testing.hpp"
@@ -935,6 +938,95 @@ TEST_CASE("ComputePartnerRanksAsExporter")
     CHECK_EQ(exp_partner_ranks, neighbor_ranks);
 }
 
+TEST_CASE("WaitUntilPathExists")
+{
+    const fs::path dir_name("co_sim_io_test_wait_for_path");
+    fs::create_directory(dir_name);
+    const fs::path file_name(dir_name / "file.dat");
+    const fs::path tmp_file_name(dir_name / "file.dat.tmp");
+
+    SUBCASE("existing")
+    {
+        std::ofstream output_file(file_name);
+        output_file.close();
+        Utilities::WaitUntilPathExists(file_name);
+    }
+
+    SUBCASE("created")
+    {
+        std::thread ext_thread([&file_name](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            std::ofstream output_file(file_name);
+        });
+
+        Utilities::WaitUntilPathExists(file_name);
+        ext_thread.join();
+    }
+
+    SUBCASE("renamed")
+    {
+        std::thread ext_thread([&file_name, &tmp_file_name](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            std::ofstream output_file(tmp_file_name);
+            output_file.close();
+            fs::rename(tmp_file_name, file_name);
+        });
+
+        Utilities::WaitUntilPathExists(file_name);
+        ext_thread.join();
+    }
+
+    SUBCASE("in_non_existing_directory")
+    {
+        const fs::path sub_dir_name(dir_name / "sub_dir");
+        const fs::path file_name_sub_dir(sub_dir_name / "file.dat");
+
+        std::thread ext_thread([&sub_dir_name, &file_name_sub_dir](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            fs::create_directory(sub_dir_name);
+            std::ofstream output_file(file_name_sub_dir);
+        });
+
+        Utilities::WaitUntilPathExists(file_name_sub_dir);
+        ext_thread.join();
+    }
+
+    const bool file_exists = fs::exists(file_name) || fs::exists(dir_name / "sub_dir" / "file.dat");
+    CHECK(file_exists);
+
+    fs::remove_all(dir_name);
+}
+
+TEST_CASE("WaitUntilPathIsRemoved")
+{
+    const fs::path dir_name("co_sim_io_test_wait_for_removed_path");
+    fs::create_directory(dir_name);
+    const fs::path file_name(dir_name / "file.dat");
+
+    SUBCASE("not_existing")
+    {
+        Utilities::WaitUntilPathIsRemoved(file_name);
+    }
+
+    SUBCASE("removed")
+    {
+        std::ofstream output_file(file_name);
+        output_file.close();
+
+        std::thread ext_thread([&file_name](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            fs::remove(file_name);
+        });
+
+        Utilities::WaitUntilPathIsRemoved(file_name);
+        ext_thread.join();
+    }
+
+    CHECK_FALSE(fs::exists(file_name));
+
+    fs::remove_all(dir_name);
+}
+
 } // TEST_SUITE("Utilities")
 
 } // namespace CoSimIO
@@ -14,6 +14,7 @@
 
 # python imports
 import unittest
+from array import array
 
 import CoSimIO
 
@@ -24,6 +25,24 @@ class CoSimIO_Misc(unittest.TestCase):
         self.assertTrue(hasattr(CoSimIO, "__version__"))
         self.assertNotEqual(CoSimIO.__version__, "")
 
+    def test_data_buffer_checks(self):
+        # the buffer is checked before the connection, hence no connection is needed
+        info = CoSimIO.Info()
+        info.SetString("identifier", "dummy")
+        info.SetString("connection_name", "dummy")
+
+        scalar_buffer = memoryview(bytes(8)).cast('d', shape=[]) # 0-dimensional
+        matrix_buffer = memoryview(bytes(32)).cast('d', shape=[2,2])
+        non_contiguous_buffer = memoryview(array('d', [1.0] * 4))[::2]
+        unsupported_buffer = array('b', [1, 2])
+
+        for buffer in [scalar_buffer, matrix_buffer, non_contiguous_buffer, unsupported_buffer]:
+            with self.assertRaises(Exception):
+                CoSimIO.ExportData(info, buffer)
+
+        with self.assertRaisesRegex(Exception, "Buffer dimension of 1 is required, got: 0"):
+            CoSimIO.ImportData(info, memoryview(bytearray(8)).cast('d', shape=[]))
+
 
 if __name__ == '__main__':
     unittest.main()
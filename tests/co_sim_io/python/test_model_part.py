@@ -42,6 +42,21 @@ class CoSimIO_ModelPart(unittest.TestCase):
             node = CoSimIO.Node(node_id, coords)
             Check(node)
 
+    def test_node_set_coordinates(self):
+        coords = [1.0, -2.7, 9.44]
+
+        with self.subTest("from_coords"):
+            node = CoSimIO.Node(16, 0.2, -33.4, 647)
+            node.SetCoordinates(coords[0], coords[1], coords[2])
+            for i in range(3):
+                self.assertAlmostEqual(coords[i], node.Coordinates()[i], msg=str(i))
+
+        with self.subTest("from_coords_array"):
+            node = CoSimIO.Node(16, 0.2, -33.4, 647)
+            node.SetCoordinates(coords)
+            for i in range(3):
+                self.assertAlmostEqual(coords[i], node.Coordinates()[i], msg=str(i))
+
     def test_print_node(self):
         coords = [1.0, -2.7, 9.44]
         node_id = 16
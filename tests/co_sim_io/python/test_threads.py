@@ -0,0 +1,138 @@
+#     ______     _____ _           ________
+#    / ____/___ / ___/(_)___ ___  /  _/ __ |
+#   / /   / __ \\__ \/ / __ `__ \ / // / / /
+#  / /___/ /_/ /__/ / / / / / / // // /_/ /
+#  \____/\____/____/_/_/ /_/ /_/___/\____/
+#  Kratos CoSimulationApplication
+#
+#  License:         BSD License, see license.txt
+#
+#  Main authors:    Philipp Bucher (https://github.com/philbucher)
+#
+
+# tests for using several connections from different Python threads
+# this requires that the GIL is released in the blocking functions
+
+# python imports
+import unittest
+import threading
+import subprocess
+import sys, os, time
+
+import CoSimIO
+
+
+def GetValues(name):
+    return [float(len(name)), ord(name[-1])+0.5, -3.25]
+
+
+def Connect(my_name, connect_to):
+    settings = CoSimIO.Info()
+    settings.SetString("my_name", my_name)
+    settings.SetString("connect_to", connect_to)
+    settings.SetInt("echo_level", 0)
+
+    return CoSimIO.Connect(settings).GetString("connection_name")
+
+
+def Disconnect(connection_name):
+    disconnect_settings = CoSimIO.Info()
+    disconnect_settings.SetString("connection_name", connection_name)
+    CoSimIO.Disconnect(disconnect_settings)
+
+
+def GetDataInfo(connection_name):
+    info = CoSimIO.Info()
+    info.SetString("identifier", "data_exchange")
+    info.SetString("connection_name", connection_name)
+    return info
+
+
+def CheckValues(values, name):
+    exp_values = GetValues(name)
+    return len(values) == len(exp_values) and all(abs(v-e) < 1e-12 for v, e in zip(values, exp_values))
+
+
+def RunPartner(my_name, connect_to, wait_for_file_name):
+    # exports first, then imports
+    connection_name = Connect(my_name, connect_to)
+
+    if wait_for_file_name:
+        start_time = time.time()
+        while not os.path.isfile(wait_for_file_name):
+            time.sleep(0.01)
+            if time.time() - start_time > 60:
+                return False
+
+    CoSimIO.ExportData(GetDataInfo(connection_name), CoSimIO.DoubleVector(GetValues(my_name)))
+    imported_values = CoSimIO.DoubleVector()
+    CoSimIO.ImportData(GetDataInfo(connection_name), imported_values)
+
+    Disconnect(connection_name)
+
+    return CheckValues(imported_values, connect_to)
+
+
+class CoSimIO_Threads(unittest.TestCase):
+
+    def setUp(self):
+        self.file_name = os.path.abspath("co_sim_io_test_threads_flag.txt")
+        if os.path.isfile(self.file_name):
+            os.remove(self.file_name)
+
+    def tearDown(self):
+        if os.path.isfile(self.file_name):
+            os.remove(self.file_name)
+
+    def test_connections_in_threads(self):
+        # this process is coupled to two partners (running in separate processes), each connection is used in its own thread
+        # partner "a" only sends its data after the exchange with partner "b" is completed
+        # this can only work if the thread that waits for the data of partner "a" does not block the other thread
+        my_name = "threads_main"
+        partner_a = "threads_partner_a"
+        partner_b = "threads_partner_b"
+
+        partner_processes = [
+            subprocess.Popen([sys.executable, __file__, partner_a, my_name, self.file_name]),
+            subprocess.Popen([sys.executable, __file__, partner_b, my_name])
+        ]
+
+        results = {}
+
+        def ExchangeData(connect_to, create_file):
+            # imports first, then exports
+            connection_name = Connect(my_name, connect_to)
+            imported_values = CoSimIO.DoubleVector()
+            CoSimIO.ImportData(GetDataInfo(connection_name), imported_values)
+            CoSimIO.ExportData(GetDataInfo(connection_name), CoSimIO.DoubleVector(GetValues(my_name)))
+            Disconnect(connection_name)
+
+            results[connect_to] = CheckValues(imported_values, connect_to)
+
+            if create_file:
+                open(self.file_name, 'w').close()
+
+        threads = [
+            threading.Thread(target=ExchangeData, args=(partner_a, False), daemon=True),
+            threading.Thread(target=ExchangeData, args=(partner_b, True), daemon=True)
+        ]
+
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join(60)
+            self.assertFalse(t.is_alive(), msg="Thread is hanging, GIL might not be released!")
+
+        for p in partner_processes:
+            self.assertEqual(p.wait(60), 0)
+
+        self.assertTrue(results[partner_a])
+        self.assertTrue(results[partner_b])
+
+
+if __name__ == '__main__':
+    if len(sys.argv) > 2: # running as partner for the test
+        wait_for_file_name = sys.argv[3] if len(sys.argv) > 3 else None
+        sys.exit(not RunPartner(sys.argv[1], sys.argv[2], wait_for_file_name))
+    else:
+        unittest.main()
@@ -147,6 +147,36 @@ class CoSimIO_DoubleVector(CoSimIO_Vector.BaseTests):
         for a, v in zip(arr, vec):
             self.assertAlmostEqual(a,v)
 
+    @unittest.skipUnless(numpy_available, "this test requries numpy")
+    def test_construction_from_non_contiguous_numpy_array(self):
+        arr = np.array([1.1,2.2,-3.2,4,5,6.78,7,8.78,9], dtype=np.double)[::2]
+
+        vec = self._CreateVector(arr)
+        self.assertEqual(vec.size(), arr.size)
+
+        for a, v in zip(arr, vec):
+            self.assertAlmostEqual(a,v)
+
+    def test_buffer_protocol(self):
+        vec = self._CreateVector([1.5, 2.5, -3.5])
+
+        view = memoryview(vec)
+        self.assertEqual(view.format, "d")
+        self.assertEqual(view.shape, (3,))
+        self.assertEqual(view.tolist(), [1.5, 2.5, -3.5])
+
+        # the memory is shared
+        view[1] = 11.25
+        self.assertAlmostEqual(vec[1], 11.25)
+
+    @unittest.skipUnless(numpy_available, "this test requries numpy")
+    def test_numpy_asarray_does_not_copy(self):
+        vec = self._CreateVector([1.5, 2.5, -3.5])
+
+        arr = np.asarray(vec)
+        arr[2] = 7.75
+        self.assertAlmostEqual(vec[2], 7.75)
+
 class CoSimIO_IntVector(CoSimIO_Vector.BaseTests):
     def _CreateVector(self, *args):
         return CoSimIO.IntVector(*args)
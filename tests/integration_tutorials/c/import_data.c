@@ -23,6 +23,7 @@ int main(int argc, const char** argv)
 {
     /* declaring variables */
     CoSimIO_Info connection_settings, connect_info, import_settings, import_info, disconnect_settings, disconnect_info;
+    CoSimIO_Info statistics, import_statistics, data_statistics;
     const char* connection_name;
     double* data;
     int data_allocated_size = 0;
@@ -55,6 +56,15 @@ int main(int argc, const char** argv)
     CoSimIO_FreeInfo(import_info);
     CoSimIO_FreeInfo(import_settings);
 
+    /* Querying the statistics of the connection, only the "connection_name" is needed */
+    statistics = CoSimIO_GetStatistics(connect_info);
+    import_statistics = CoSimIO_Info_GetInfo(statistics, "import_data");
+    data_statistics = CoSimIO_Info_GetInfo(import_statistics, "vector_of_pi");
+    COSIMIO_CHECK_EQUAL(CoSimIO_Info_GetInt(data_statistics, "count"), 1);
+    CoSimIO_FreeInfo(data_statistics);
+    CoSimIO_FreeInfo(import_statistics);
+    CoSimIO_FreeInfo(statistics);
+
     /* Freeing the data using CoSimIO_Free. (Not the standard free()) */
     CoSimIO_Free(data);
 
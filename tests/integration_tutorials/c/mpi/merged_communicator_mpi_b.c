@@ -0,0 +1,89 @@
+/*   ______     _____ _           ________
+    / ____/___ / ___/(_)___ ___  /  _/ __ |
+   / /   / __ \\__ \/ / __ `__ \ / // / / /
+  / /___/ /_/ /__/ / / / / / / // // /_/ /
+  \____/\____/____/_/_/ /_/ /_/___/\____/
+  Kratos CoSimulationApplication
+
+  License:         BSD License, see license.txt
+
+  Main authors:    Philipp Bucher (https://github.com/philbucher)
+*/
+
+/* This test checks the merged communicator that contains the ranks of both partners (this is the secondary connection).
+   Usage: mpiexec -np N merged_communicator_mpi_b <communication_format>
+*/
+
+/* External includes */
+#include "mpi.h"
+
+/* CoSimulation includes */
+#include "c/co_sim_io_c_mpi.h"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        printf("in line %d : %d is not equal to %d\n", __LINE__ , a, b); \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    /* declaring variables */
+    CoSimIO_Info settings, connect_info, merged_comm_settings, disconnect_settings, disconnect_info;
+    const char* connection_name;
+    MPI_Comm merged_comm;
+    int rank, size, merged_rank, merged_size, num_primary_ranks, num_secondary_ranks, sum_values;
+    int is_primary = 0; /* counting the ranks of the primary connection */
+
+    MPI_Init(&argc, &argv); /* needs to be done before calling CoSimIO_ConnectMPI */
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    COSIMIO_CHECK_EQUAL(argc, 2);
+
+    settings = CoSimIO_CreateInfo();
+    CoSimIO_Info_SetString(settings, "my_name", "c_merged_communicator_b");
+    CoSimIO_Info_SetString(settings, "connect_to", "c_merged_communicator_a");
+    CoSimIO_Info_SetString(settings, "communication_format", argv[1]);
+    CoSimIO_Info_SetBool(settings, "merge_communicators", 1);
+    CoSimIO_Info_SetInt(settings, "echo_level", 0);
+
+    connect_info = CoSimIO_ConnectMPI(settings, MPI_COMM_WORLD);
+    connection_name = CoSimIO_Info_GetString(connect_info, "connection_name");
+    COSIMIO_CHECK_EQUAL(CoSimIO_Info_GetInt(connect_info, "connection_status"), CoSimIO_Connected);
+
+    merged_comm_settings = CoSimIO_CreateInfo();
+    CoSimIO_Info_SetString(merged_comm_settings, "connection_name", connection_name);
+    merged_comm = CoSimIO_GetMergedMPICommunicator(merged_comm_settings);
+
+    MPI_Comm_rank(merged_comm, &merged_rank);
+    MPI_Comm_size(merged_comm, &merged_size);
+
+    /* the ranks of the primary connection come first */
+    MPI_Allreduce(&is_primary, &num_primary_ranks, 1, MPI_INT, MPI_SUM, merged_comm);
+    COSIMIO_CHECK_EQUAL(merged_size, num_primary_ranks+size);
+    COSIMIO_CHECK_EQUAL(merged_rank, num_primary_ranks+rank);
+
+    /* e.g. computing a global norm across both partners */
+    num_secondary_ranks = merged_size - num_primary_ranks;
+    rank += 1;
+    MPI_Allreduce(&rank, &sum_values, 1, MPI_INT, MPI_SUM, merged_comm);
+    COSIMIO_CHECK_EQUAL(sum_values, (num_primary_ranks*(num_primary_ranks+1) + num_secondary_ranks*(num_secondary_ranks+1))/2);
+
+    disconnect_settings = CoSimIO_CreateInfo();
+    CoSimIO_Info_SetString(disconnect_settings, "connection_name", connection_name);
+    disconnect_info = CoSimIO_Disconnect(disconnect_settings); /* disconnect afterwards */
+    COSIMIO_CHECK_EQUAL(CoSimIO_Info_GetInt(disconnect_info, "connection_status"), CoSimIO_Disconnected);
+
+    /* Don't forget to release the settings and info */
+    CoSimIO_FreeInfo(settings);
+    CoSimIO_FreeInfo(connect_info);
+    CoSimIO_FreeInfo(merged_comm_settings);
+    CoSimIO_FreeInfo(disconnect_settings);
+    CoSimIO_FreeInfo(disconnect_info);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -44,6 +44,11 @@ int main(int argc, const char** argv)
     for(auto& value : receive_data)
         COSIMIO_CHECK_EQUAL(value, 3.14);
 
+    CoSimIO::Info statistics_settings;
+    statistics_settings.Set("connection_name", connection_name);
+    const CoSimIO::Info statistics = CoSimIO::GetStatistics(statistics_settings);
+    COSIMIO_CHECK_EQUAL(statistics.Get<CoSimIO::Info>("import_data").Get<CoSimIO::Info>("vector_of_pi").Get<int>("count"), 1);
+
     CoSimIO::Info disconnect_settings;
     disconnect_settings.Set("connection_name", connection_name);
     info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
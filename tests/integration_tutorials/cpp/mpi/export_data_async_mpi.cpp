@@ -0,0 +1,110 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// This test overlaps asynchronous exports with asynchronous imports of data from the partner.
+// The asynchronous operations require MPI to be initialized with MPI_THREAD_MULTIPLE.
+// Usage: mpiexec -np N export_data_async_mpi <communication_format>
+
+// System includes
+#include <vector>
+#include <string>
+#include <future>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    COSIMIO_CHECK_EQUAL(argc, 2);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_async_export_solver");
+    settings.Set("connect_to", "cpp_async_import_solver");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("echo_level", 0);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    CoSimIO::Info export_info;
+    export_info.Set("identifier", "data_async");
+    export_info.Set("connection_name", connection_name);
+
+    if (provided < MPI_THREAD_MULTIPLE) {
+        // the partner also skips the exchange, as it uses the same MPI
+        bool has_thrown = false;
+        std::vector<double> data_to_send(5);
+        try {
+            CoSimIO::ExportDataAsync(export_info, data_to_send);
+        } catch (const std::exception&) {
+            has_thrown = true;
+        }
+        COSIMIO_CHECK_EQUAL(has_thrown, true);
+    } else {
+        CoSimIO::Info import_info;
+        import_info.Set("identifier", "data_partner");
+        import_info.Set("connection_name", connection_name);
+
+        // large enough such that the messages are not sent eagerly
+        const std::size_t num_values = 100000;
+        const int num_iterations = 5;
+
+        // the data must not be accessed until the operations are completed
+        std::vector<std::vector<double>> data_to_send(num_iterations);
+        std::vector<std::vector<double>> data_received(num_iterations);
+        std::vector<std::future<CoSimIO::Info>> futures;
+
+        for (int i=0; i<num_iterations; ++i) {
+            // the send is posted by this thread while the asynchronous thread receives the data of the previous iteration
+            data_to_send[i].assign(num_values+rank, static_cast<double>(i+rank));
+            futures.push_back(CoSimIO::ExportDataAsync(export_info, data_to_send[i]));
+            futures.push_back(CoSimIO::ImportDataAsync(import_info, data_received[i]));
+        }
+
+        for (auto& r_future : futures) {
+            r_future.get();
+        }
+
+        for (int i=0; i<num_iterations; ++i) {
+            COSIMIO_CHECK_EQUAL(data_received[i].size(), num_values+2*rank);
+            for (const double value : data_received[i]) {
+                COSIMIO_CHECK_EQUAL(value, static_cast<double>(-i-rank));
+            }
+        }
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// This test exports to a partner that runs with a different number of processes.
+// Usage: mpiexec -np N export_m_n_mpi <communication_format>
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    COSIMIO_CHECK_EQUAL(argc, 2);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_m_n_export_solver");
+    settings.Set("connect_to", "cpp_m_n_import_solver");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("echo_level", 0);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    // the partner needs to know my size to compute what it receives
+    info.Clear();
+    info.Set("identifier", "exporter_size");
+    info.Set("connection_name", connection_name);
+    info.Set("num_processes", size);
+    CoSimIO::ExportInfo(info);
+
+    // each rank exports rank+1 values
+    std::vector<double> data_to_send(rank+1, static_cast<double>(rank));
+    info.Clear();
+    info.Set("identifier", "data_m_n");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ExportData(info, data_to_send);
+
+    // each rank has two local nodes and one ghost node that belongs to the next rank
+    CoSimIO::ModelPart model_part("mp_m_n");
+    model_part.CreateNewNode(rank*10+1, rank, 0.0, 0.0);
+    model_part.CreateNewNode(rank*10+2, rank, 1.0, 0.0);
+    if (size > 1) {
+        const int next_rank = (rank+1)%size;
+        model_part.CreateNewGhostNode(next_rank*10+1, next_rank, 0.0, 0.0, next_rank);
+        model_part.CreateNewElement(rank+1, CoSimIO::ElementType::Line2D2, {rank*10+2, next_rank*10+1});
+    } else {
+        model_part.CreateNewElement(rank+1, CoSimIO::ElementType::Line2D2, {rank*10+1, rank*10+2});
+    }
+
+    info.Clear();
+    info.Set("identifier", "mesh_m_n");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ExportMesh(info, model_part);
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// This test is the partner of export_data_async_mpi, it exchanges the data with blocking operations.
+// Usage: mpiexec -np N import_data_async_mpi <communication_format>
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    COSIMIO_CHECK_EQUAL(argc, 2);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_async_import_solver");
+    settings.Set("connect_to", "cpp_async_export_solver");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("echo_level", 0);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    if (provided == MPI_THREAD_MULTIPLE) {
+        CoSimIO::Info import_info;
+        import_info.Set("identifier", "data_async");
+        import_info.Set("connection_name", connection_name);
+
+        CoSimIO::Info export_info;
+        export_info.Set("identifier", "data_partner");
+        export_info.Set("connection_name", connection_name);
+
+        const std::size_t num_values = 100000;
+
+        for (int i=0; i<5; ++i) {
+            std::vector<double> data_received;
+            CoSimIO::ImportData(import_info, data_received);
+
+            COSIMIO_CHECK_EQUAL(data_received.size(), num_values+rank);
+            for (const double value : data_received) {
+                COSIMIO_CHECK_EQUAL(value, static_cast<double>(i+rank));
+            }
+
+            std::vector<double> data_to_send(num_values+2*rank, static_cast<double>(-i-rank));
+            CoSimIO::ExportData(export_info, data_to_send);
+        }
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// This test imports data repeatedly while the size of the data changes, see export_data_sizes_mpi.
+// Usage: mpiexec -np N import_data_sizes_mpi <communication_format> [<bool setting that is enabled>]
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    COSIMIO_CHECK_EQUAL((argc == 2 || argc == 3), true);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_sizes_import_solver");
+    settings.Set("connect_to", "cpp_sizes_export_solver");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("echo_level", 0);
+    if (argc == 3) {
+        settings.Set(std::string(argv[2]), true);
+    }
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    // the size of the data changes between the exchanges, also to zero
+    const std::vector<std::size_t> sizes {4, 4, 4, 9, 9, 0, 0, 5, 5, 5, 12, 3, 3};
+
+    info.Clear();
+    info.Set("identifier", "data_sizes");
+    info.Set("connection_name", connection_name);
+
+    std::vector<double> data_received;
+    for (std::size_t i=0; i<sizes.size(); ++i) {
+        CoSimIO::ImportData(info, data_received);
+
+        COSIMIO_CHECK_EQUAL(data_received.size(), sizes[i]+rank);
+        for (std::size_t j=0; j<data_received.size(); ++j) {
+            COSIMIO_CHECK_EQUAL(data_received[j], static_cast<double>(1000*i + 10*j + rank));
+        }
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
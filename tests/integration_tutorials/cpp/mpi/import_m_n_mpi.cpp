@@ -0,0 +1,124 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// This test imports from a partner that runs with a different number of processes.
+// Usage: mpiexec -np M import_m_n_mpi <communication_format>
+
+// System includes
+#include <vector>
+#include <string>
+#include <set>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+#include "includes/utilities.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    COSIMIO_CHECK_EQUAL(argc, 2);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_m_n_import_solver");
+    settings.Set("connect_to", "cpp_m_n_export_solver");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("echo_level", 0);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    info.Clear();
+    info.Set("identifier", "exporter_size");
+    info.Set("connection_name", connection_name);
+    const int partner_size = CoSimIO::ImportInfo(info).Get<int>("num_processes");
+
+    // the ranks of the exporter whose data ends up on this rank
+    const std::set<std::size_t> partner_ranks = CoSimIO::Utilities::ComputePartnerRanksAsImporter(rank, size, partner_size);
+
+    std::vector<double> receive_data;
+    info.Clear();
+    info.Set("identifier", "data_m_n");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ImportData(info, receive_data);
+
+    std::vector<double> expected_data;
+    for (const std::size_t partner_rank : partner_ranks) {
+        expected_data.insert(expected_data.end(), partner_rank+1, static_cast<double>(partner_rank));
+    }
+
+    COSIMIO_CHECK_EQUAL(receive_data.size(), expected_data.size());
+    for (std::size_t i=0; i<expected_data.size(); ++i) {
+        COSIMIO_CHECK_EQUAL(receive_data[i], expected_data[i]);
+    }
+
+    CoSimIO::ModelPart model_part("mp_m_n");
+    info.Clear();
+    info.Set("identifier", "mesh_m_n");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ImportMesh(info, model_part);
+
+    // ghost nodes whose owner sends to this rank become local nodes
+    std::size_t exp_num_ghost_nodes = 0;
+    if (partner_size > 1) {
+        for (const std::size_t partner_rank : partner_ranks) {
+            const std::size_t owner_rank = (partner_rank+1)%partner_size;
+            if (*CoSimIO::Utilities::ComputePartnerRanksAsExporter(owner_rank, partner_size, size).begin() != static_cast<std::size_t>(rank)) {
+                ++exp_num_ghost_nodes;
+            }
+        }
+    }
+
+    COSIMIO_CHECK_EQUAL(model_part.NumberOfLocalNodes(), 2*partner_ranks.size());
+    COSIMIO_CHECK_EQUAL(model_part.NumberOfGhostNodes(), exp_num_ghost_nodes);
+    COSIMIO_CHECK_EQUAL(model_part.NumberOfElements(), partner_ranks.size());
+
+    for (const std::size_t partner_rank : partner_ranks) {
+        const auto& r_node = model_part.GetNode(partner_rank*10+1);
+        COSIMIO_CHECK_EQUAL(r_node.X(), static_cast<double>(partner_rank));
+        COSIMIO_CHECK_EQUAL(model_part.GetElement(partner_rank+1).NumberOfNodes(), 2);
+    }
+
+    for (const auto& r_partition : model_part.GetPartitionModelParts()) {
+        const bool is_own_partition = r_partition.first == rank;
+        COSIMIO_CHECK_EQUAL(is_own_partition, false);
+        for (const auto& r_node : r_partition.second->Nodes()) {
+            const std::size_t owner_rank = static_cast<std::size_t>(r_node.Id()/10);
+            COSIMIO_CHECK_EQUAL(static_cast<std::size_t>(r_partition.first), *CoSimIO::Utilities::ComputePartnerRanksAsExporter(owner_rank, partner_size, size).begin());
+        }
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// This test checks the merged communicator that contains the ranks of both partners (this is the primary connection).
+// Usage: mpiexec -np N merged_communicator_mpi_a <communication_format>
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    COSIMIO_CHECK_EQUAL(argc, 2);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_merged_communicator_a");
+    settings.Set("connect_to", "cpp_merged_communicator_b");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("merge_communicators", true);
+    settings.Set("echo_level", 0);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    info.Clear();
+    info.Set("connection_name", connection_name);
+    MPI_Comm merged_comm = CoSimIO::GetMergedMPICommunicator(info);
+
+    int merged_rank;
+    MPI_Comm_rank(merged_comm, &merged_rank);
+    int merged_size;
+    MPI_Comm_size(merged_comm, &merged_size);
+
+    // the ranks of the primary connection come first
+    const int is_primary = 1; // counting the ranks of the primary connection
+    int num_primary_ranks;
+    MPI_Allreduce(&is_primary, &num_primary_ranks, 1, MPI_INT, MPI_SUM, merged_comm);
+
+    COSIMIO_CHECK_EQUAL(num_primary_ranks, size);
+    COSIMIO_CHECK_EQUAL(merged_rank, rank);
+
+    // e.g. computing a global norm across both partners
+    const int num_secondary_ranks = merged_size - num_primary_ranks;
+    const double my_value = static_cast<double>(rank+1);
+    double sum_values;
+    MPI_Allreduce(&my_value, &sum_values, 1, MPI_DOUBLE, MPI_SUM, merged_comm);
+    COSIMIO_CHECK_EQUAL(sum_values, (num_primary_ranks*(num_primary_ranks+1) + num_secondary_ranks*(num_secondary_ranks+1))/2.0);
+
+    // messages of the user on the merged communicator must not interfere with the ones of the CoSimIO
+    // the tag is the same as the one the CoSimIO uses internally for the first identifier with mpi_rma
+    const int user_tag = 1;
+    int user_message = 42;
+    MPI_Request user_request;
+    if (rank == 0) {
+        MPI_Isend(&user_message, 1, MPI_INT, num_primary_ranks, user_tag, merged_comm, &user_request);
+    }
+
+    // each rank exports rank+1 values
+    std::vector<double> data_to_send(rank+1, static_cast<double>(rank));
+    info.Clear();
+    info.Set("identifier", "data_merged_comm");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ExportData(info, data_to_send);
+
+    if (rank == 0) {
+        MPI_Wait(&user_request, MPI_STATUS_IGNORE);
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
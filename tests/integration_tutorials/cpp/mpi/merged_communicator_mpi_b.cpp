@@ -0,0 +1,119 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// This test checks the merged communicator that contains the ranks of both partners (this is the secondary connection).
+// Usage: mpiexec -np N merged_communicator_mpi_b <communication_format>
+
+// System includes
+#include <vector>
+#include <string>
+#include <set>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+#include "includes/utilities.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    COSIMIO_CHECK_EQUAL(argc, 2);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_merged_communicator_b");
+    settings.Set("connect_to", "cpp_merged_communicator_a");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("merge_communicators", true);
+    settings.Set("echo_level", 0);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    info.Clear();
+    info.Set("connection_name", connection_name);
+    MPI_Comm merged_comm = CoSimIO::GetMergedMPICommunicator(info);
+
+    int merged_rank;
+    MPI_Comm_rank(merged_comm, &merged_rank);
+    int merged_size;
+    MPI_Comm_size(merged_comm, &merged_size);
+
+    // the ranks of the primary connection come first
+    const int is_primary = 0; // counting the ranks of the primary connection
+    int num_primary_ranks;
+    MPI_Allreduce(&is_primary, &num_primary_ranks, 1, MPI_INT, MPI_SUM, merged_comm);
+
+    COSIMIO_CHECK_EQUAL(merged_size, num_primary_ranks+size);
+    COSIMIO_CHECK_EQUAL(merged_rank, num_primary_ranks+rank);
+
+    // e.g. computing a global norm across both partners
+    const int num_secondary_ranks = merged_size - num_primary_ranks;
+    const double my_value = static_cast<double>(rank+1);
+    double sum_values;
+    MPI_Allreduce(&my_value, &sum_values, 1, MPI_DOUBLE, MPI_SUM, merged_comm);
+    COSIMIO_CHECK_EQUAL(sum_values, (num_primary_ranks*(num_primary_ranks+1) + num_secondary_ranks*(num_secondary_ranks+1))/2.0);
+
+    // messages of the user on the merged communicator must not interfere with the ones of the CoSimIO
+    // the tag is the same as the one the CoSimIO uses internally for the first identifier with mpi_rma
+    const int user_tag = 1;
+
+    std::vector<double> receive_data;
+    info.Clear();
+    info.Set("identifier", "data_merged_comm");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ImportData(info, receive_data);
+
+    // the ranks of the exporter whose data ends up on this rank
+    const std::set<std::size_t> partner_ranks = CoSimIO::Utilities::ComputePartnerRanksAsImporter(rank, size, num_primary_ranks);
+
+    std::vector<double> expected_data;
+    for (const std::size_t partner_rank : partner_ranks) {
+        expected_data.insert(expected_data.end(), partner_rank+1, static_cast<double>(partner_rank));
+    }
+
+    COSIMIO_CHECK_EQUAL(receive_data.size(), expected_data.size());
+    for (std::size_t i=0; i<expected_data.size(); ++i) {
+        COSIMIO_CHECK_EQUAL(receive_data[i], expected_data[i]);
+    }
+
+    // the message of the user is received only after the data, it must not have been taken by the CoSimIO
+    if (rank == 0) {
+        int user_message = 0;
+        MPI_Recv(&user_message, 1, MPI_INT, 0, user_tag, merged_comm, MPI_STATUS_IGNORE);
+        COSIMIO_CHECK_EQUAL(user_message, 42);
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
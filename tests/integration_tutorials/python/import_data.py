@@ -40,6 +40,14 @@ cosimio_check_equal(len(vec_to_import), 4)
 for value in vec_to_import:
     cosimio_check_equal(value, 3.14)
 
+# Querying the statistics of the connection
+stats_settings = CoSimIO.Info()
+stats_settings.SetString("connection_name", connection_name)
+statistics = CoSimIO.GetStatistics(stats_settings)
+import_statistics = statistics.GetInfo("import_data").GetInfo("vector_of_pi")
+cosimio_check_equal(import_statistics.GetInt("count"), 1)
+cosimio_check_equal(import_statistics.GetDouble("memory_usage_ipc") > 0, True)
+
 # Disconnecting
 disconnect_settings = CoSimIO.Info()
 disconnect_settings.SetString("connection_name", connection_name)
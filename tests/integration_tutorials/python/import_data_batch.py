@@ -0,0 +1,48 @@
+#     ______     _____ _           ________
+#    / ____/___ / ___/(_)___ ___  /  _/ __ |
+#   / /   / __ \\__ \/ / __ `__ \ / // / / /
+#  / /___/ /_/ /__/ / / / / / / // // /_/ /
+#  \____/\____/____/_/_/ /_/ /_/___/\____/
+#  Kratos CoSimulationApplication
+#
+#  License:         BSD License, see license.txt
+#
+#  Main authors:    Philipp Bucher (https://github.com/philbucher)
+#
+
+import CoSimIO
+
+def cosimio_check_equal(a, b):
+    assert a == b
+
+
+# Connection Settings
+settings = CoSimIO.Info()
+settings.SetString("my_name", "py_import_data_batch")
+settings.SetString("connect_to", "py_export_data_batch")
+settings.SetInt("echo_level", 1)
+settings.SetString("version", "1.25")
+
+# Connecting
+return_info = CoSimIO.Connect(settings)
+cosimio_check_equal(return_info.GetInt("connection_status"), CoSimIO.ConnectionStatus.Connected)
+connection_name = return_info.GetString("connection_name")
+
+# Importing several vectors in one message, the identifiers must be the same as in the export
+vec_of_pi = CoSimIO.DoubleVector()
+vec_of_ones = CoSimIO.DoubleVector([5.0] * 2) # the vectors are resized as necessary
+empty_vec = CoSimIO.DoubleVector([5.0] * 3)
+info = CoSimIO.Info()
+info.SetString("identifier", "batch_of_vectors")
+info.SetString("connection_name", connection_name)
+return_info = CoSimIO.ImportDataBatch(info, [("vector_of_pi", vec_of_pi), ("vector_of_ones", vec_of_ones), ("empty_vector", empty_vec)])
+
+cosimio_check_equal(list(vec_of_pi), [3.14] * 4)
+cosimio_check_equal(list(vec_of_ones), [1.0] * 7)
+cosimio_check_equal(len(empty_vec), 0)
+
+# Disconnecting
+disconnect_settings = CoSimIO.Info()
+disconnect_settings.SetString("connection_name", connection_name)
+return_info = CoSimIO.Disconnect(disconnect_settings)
+cosimio_check_equal(return_info.GetInt("connection_status"), CoSimIO.ConnectionStatus.Disconnected)
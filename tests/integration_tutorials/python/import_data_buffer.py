@@ -0,0 +1,57 @@
+#     ______     _____ _           ________
+#    / ____/___ / ___/(_)___ ___  /  _/ __ |
+#   / /   / __ \\__ \/ / __ `__ \ / // / / /
+#  / /___/ /_/ /__/ / / / / / / // // /_/ /
+#  \____/\____/____/_/_/ /_/ /_/___/\____/
+#  Kratos CoSimulationApplication
+#
+#  License:         BSD License, see license.txt
+#
+#  Main authors:    Philipp Bucher (https://github.com/philbucher)
+#
+
+from array import array
+
+import CoSimIO
+
+def cosimio_check_equal(a, b):
+    assert a == b
+
+
+# Connection Settings
+settings = CoSimIO.Info()
+settings.SetString("my_name", "py_import_data_buffer")
+settings.SetString("connect_to", "py_export_data_buffer")
+settings.SetInt("echo_level", 1)
+settings.SetString("version", "1.25")
+
+# Connecting
+return_info = CoSimIO.Connect(settings)
+cosimio_check_equal(return_info.GetInt("connection_status"), CoSimIO.ConnectionStatus.Connected)
+connection_name = return_info.GetString("connection_name")
+
+# Importing data directly into objects supporting the buffer protocol (e.g. numpy arrays), without copying
+# the size of the buffer has to match the size of the imported data
+info = CoSimIO.Info()
+info.SetString("connection_name", connection_name)
+
+info.SetString("identifier", "array_of_pi")
+array_to_import = array('d', [0.0] * 4)
+CoSimIO.ImportData(info, array_to_import)
+cosimio_check_equal(list(array_to_import), [3.14] * 4)
+
+info.SetString("identifier", "memoryview_of_ints")
+ints_to_import = array('i', [0] * 3)
+CoSimIO.ImportData(info, memoryview(ints_to_import))
+cosimio_check_equal(list(ints_to_import), [1, -2, 3])
+
+info.SetString("identifier", "array_of_floats")
+floats_to_import = array('f', [0.0] * 2)
+CoSimIO.ImportData(info, floats_to_import)
+cosimio_check_equal(list(floats_to_import), [0.5, 1.5])
+
+# Disconnecting
+disconnect_settings = CoSimIO.Info()
+disconnect_settings.SetString("connection_name", connection_name)
+return_info = CoSimIO.Disconnect(disconnect_settings)
+cosimio_check_equal(return_info.GetInt("connection_status"), CoSimIO.ConnectionStatus.Disconnected)
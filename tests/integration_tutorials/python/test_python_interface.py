@@ -40,6 +40,12 @@ class PythonInterfaceTests(unittest.TestCase):
     def test_import_export_data(self):
         self.__RunScripts("export_data.py", "import_data.py")
 
+    def test_import_export_data_buffer(self):
+        self.__RunScripts("export_data_buffer.py", "import_data_buffer.py")
+
+    def test_import_export_data_batch(self):
+        self.__RunScripts("export_data_batch.py", "import_data_batch.py")
+
     def test_import_export_mesh(self):
         self.__RunScripts("export_mesh.py", "import_mesh.py")
 